@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Enums/NodeShape.h"
+
+/**
+ * @struct NodeBounds
+ * @brief Bounding circle of a node, shared by the damage zone test and render culling.
+ *
+ * Squares and bosses rotate, so their circle reaches the corners; the other shapes fit
+ * inside a circle of radius `size`.
+ */
+struct NodeBounds {
+    static constexpr float SQUARE_DIAGONAL_RATIO = 1.414f; // approx sqrt(2)
+
+    /** @brief Radius of the circle that contains the node at any rotation. */
+    static constexpr float GetRadius(NodeShape shape, float size) {
+        return (shape == NodeShape::Square || shape == NodeShape::Boss) ? size * SQUARE_DIAGONAL_RATIO : size;
+    }
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Types/Position.h"
+
+/**
+ * @class SweptZoneQuery
+ * @brief Batched test of the square damage zone, swept from one cursor position to the next, against many targets.
+ *
+ * Each target is a box (half-size 0 for a circle) with its corners rounded by a radius. Moving
+ * the zone along a segment hits a target exactly when the segment meets the target grown by
+ * the zone, so the test is segment-vs-rounded-box: two separating-axis box tests plus the
+ * distance to the four corners. Targets are kept as separate coordinate arrays and the loop has
+ * no branches or divisions, so the compiler can vectorise it. With from == to it is the plain
+ * overlap test with the zone at a single position.
+ */
+class SweptZoneQuery {
+public:
+    /** @brief Removes all targets; the arrays keep their capacity for the next frame. */
+    void Clear();
+
+    /**
+     * @brief Adds a target; targets are numbered in the order they are added.
+     * @param halfSize Half the width of the target's box (0 for a circle).
+     * @param radius Rounding added around the box (the radius for a circle, 0 for a box).
+     */
+    void Add(const Position& center, float halfSize, float radius);
+
+    /** @brief Tests every target against the zone of width zoneSize moving from `from` to `to`. */
+    void Run(const Position& from, const Position& to, float zoneSize);
+
+    /** @brief Result of the last Run() for the target added at `index`. */
+    bool IsHit(size_t index) const { return m_Hits[index] != 0; }
+
+    size_t GetCount() const { return m_X.size(); }
+
+private:
+    std::vector<float> m_X;
+    std::vector<float> m_Y;
+    std::vector<float> m_HalfSize;
+    std::vector<float> m_Radius;
+    std::vector<uint32_t> m_Hits; // Full-width lanes, so the loop stays in one vector width
+};
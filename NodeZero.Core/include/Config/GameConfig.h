@@ -13,6 +13,10 @@ struct GameConfig {
     /** @brief Base movement speed of enemy nodes (Pixels per Second). */
     static constexpr float NODE_DEFAULT_SPEED = 75.0f;
 
+    /** @brief Distance outside any screen edge beyond which a regular node is despawned (Pixels).
+     * Must stay larger than the spawn offset plus the node size, or nodes die on spawn. */
+    static constexpr float NODE_DESPAWN_MARGIN = 200.0f;
+
     // --- Pickup Settings ---
 
     /** @brief How long a point pickup remains on screen before vanishing (Seconds). */
@@ -74,4 +78,10 @@ struct GameConfig {
 
     /** @brief Time required to survive to complete a level (Seconds). */
     static constexpr float LEVEL_DURATION = 60.0f;
+
+    // --- Simulation Settings ---
+
+    /** @brief Fixed simulation rate when the game runs on its own thread (Ticks per Second).
+     * Matches the render frame cap, so every rendered frame can show a new tick. */
+    static constexpr float SIMULATION_TICK_RATE = 240.0f;
 };
\ No newline at end of file
@@ -36,5 +36,8 @@ enum class EventType {
     BossDefeated,
 
     /** @brief Triggered when the level timer expires successfully. */
-    LevelCompleted
+    LevelCompleted,
+
+    /** @brief Triggered when a point pickup is collected by the damage zone. */
+    PickupCollected
 };
\ No newline at end of file
@@ -80,6 +80,7 @@ public:
         case EventType::BossSpawned:      return "BossSpawned";
         case EventType::BossDefeated:     return "BossDefeated";
         case EventType::LevelCompleted:   return "LevelCompleted";
+        case EventType::PickupCollected:  return "PickupCollected";
         default:                          return "Unknown";
         }
     }
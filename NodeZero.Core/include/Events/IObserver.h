@@ -1,7 +1,5 @@
 #pragma once
 
-#include <memory>
-
 class IEvent;
 
 /**
@@ -17,6 +15,7 @@ public:
     /**
      * @brief Called by the Subject when an event occurs.
      * @param event The generic event data. Cast to specific types (e.g., GameEvent) to use.
+     * The event only lives for the duration of the call; copy whatever is needed later.
      */
-    virtual void Update(const std::shared_ptr<IEvent>& event) = 0;
+    virtual void Update(const IEvent& event) = 0;
 };
\ No newline at end of file
@@ -27,6 +27,7 @@ public:
 
     /**
      * @brief Broadcasts an event to all attached observers.
+     * The event may be a temporary: observers must not keep references to it.
      */
-    virtual void Notify(const std::shared_ptr<IEvent>& event) = 0;
+    virtual void Notify(const IEvent& event) = 0;
 };
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <list>
 #include <memory>
+#include <vector>
 
 #include "IEvent.h"
 #include "IObserver.h"
@@ -12,7 +12,8 @@
  * @brief Concrete implementation of the ISubject interface.
  *
  * Maintains a thread-unsafe list of observers.
- * Note: Notify() is safe against observers detaching themselves during the update loop.
+ * Note: Notify() is safe against observers attaching or detaching (themselves or others)
+ * during the update loop, without copying the list for every event.
  */
 class Subject : public ISubject {
 public:
@@ -21,9 +22,11 @@ public:
 
     void Attach(std::shared_ptr<IObserver> observer) override;
     void Detach(std::shared_ptr<IObserver> observer) override;
-    void Notify(const std::shared_ptr<IEvent>& event) override;
+    void Notify(const IEvent& event) override;
 
 private:
-    /** @brief List used for efficient insertion/removal of observers. */
-    std::list<std::shared_ptr<IObserver>> m_observers;
+    /** @brief Observers in attach order; detached ones are null until the outermost Notify() ends. */
+    std::vector<std::shared_ptr<IObserver>> m_observers;
+    int m_notifyDepth = 0;
+    bool m_hasDetached = false;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <vector>
 #include "Events/ISubject.h"
 #include "Types/PointPickup.h"
+#include "Types/RenderView.h"
 #include "Types/SpawnInfo.h"
 
 // Forward declarations
@@ -33,17 +34,29 @@ public:
     virtual void StartNextLevel() = 0;
 
     // --- Inputs ---
+    /** @brief Cursor position for the next Update; the damage zone sweeps there from the previous update's position. */
     virtual void SetMousePosition(float x, float y) = 0;
 
+    /** @brief Makes the next Update test only the new position, e.g. after a pause during which the cursor moved. */
+    virtual void ResetMouseTrail() = 0;
+
     // --- Entity Management ---
     virtual void SpawnNode(const SpawnInfo& info) = 0;
     virtual const std::vector<INode*>& GetNodes() const = 0;
-    virtual std::vector<PointPickup> GetCollectedPickupsThisFrame() const = 0;
+
+    /**
+     * @brief Draw-ready node and pickup arrays, rebuilt at most once per update.
+     * Renderers read these instead of walking GetNodes(): no virtual calls, no copies.
+     */
+    virtual RenderView GetRenderView() const = 0;
 
     // --- Game State/Stats ---
     virtual float GetScreenWidth() const = 0;
     virtual float GetScreenHeight() const = 0;
     virtual int GetNodesDestroyed() const = 0;
+    virtual int GetLiveNodeCount() const = 0;
+    virtual int GetPeakNodeCount() const = 0;
+    virtual int GetNodesDespawned() const = 0;
     virtual int GetHighPoints() const = 0;
     virtual void SaveProgress() = 0;
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Memory/FrameArena.h"
+
+/**
+ * @class ArenaAllocator
+ * @brief Standard allocator that takes its memory from a FrameArena.
+ *
+ * deallocate() does nothing; the memory comes back with FrameArena::Reset(). A container
+ * using it must therefore be destroyed (or at least never touched again) before that reset.
+ * Reserve up front where the size is known: a growing vector leaves its old buffers unused
+ * in the arena until the reset.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : m_Arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_Arena(other.m_Arena) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_Arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_Arena == other.m_Arena; }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_Arena != other.m_Arena; }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    FrameArena* m_Arena;
+};
+
+/** @brief A vector for one tick's scratch data: `ArenaVector<int> values{ ArenaAllocator<int>(arena) };` */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
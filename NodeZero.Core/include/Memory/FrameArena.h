@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Monotonic allocator for data that lives for one simulation tick.
+ *
+ * Allocation bumps an offset in the current block; nothing is freed individually.
+ * Reset() makes the whole arena reusable at once, keeping its blocks, so once the
+ * arena has grown to a tick's peak usage, allocating from it never reaches the
+ * global heap again. A request that does not fit adds a block.
+ *
+ * Not thread-safe: it belongs to whichever thread currently owns the Game.
+ */
+class FrameArena {
+public:
+    explicit FrameArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Returns `size` bytes aligned to `alignment` (a power of two), valid until the next Reset().
+     */
+    void* Allocate(size_t size, size_t alignment);
+
+    /** @brief Releases everything allocated since the last reset; the blocks are kept for reuse. */
+    void Reset();
+
+    /** @brief Bytes handed out since the last reset, including alignment padding. */
+    size_t GetUsed() const;
+
+    /** @brief Total size of the blocks the arena holds. */
+    size_t GetCapacity() const;
+
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> m_Blocks;
+    size_t m_BlockSize;
+    size_t m_Current{ 0 };  // Block being allocated from
+    size_t m_Offset{ 0 };   // Next free byte in m_Blocks[m_Current]
+    size_t m_UsedBefore{ 0 }; // Bytes used in the blocks before m_Current
+};
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <functional>
-#include <vector>
+
+#include "../Types/Position.h"
+#include "../Types/Span.h"
 
 class Node;
 
@@ -17,24 +19,24 @@ class IDamageZoneService {
     virtual ~IDamageZoneService() = default;
 
     /**
-     * @brief Processes a damage zone, applying damage to all nodes within it.
+     * @brief Processes a damage zone, applying damage to all nodes it touched while moving from one cursor position to the next.
      *
-     * @param centerX The X coordinate of the zone's center.
-     * @param centerY The Y coordinate of the zone's center.
+     * @param from The zone's center at the previous update.
+     * @param to The zone's center now; pass `from` to test a single position.
      * @param zoneSize The width/height of the square damage zone.
      * @param damage The amount of damage to apply to affected nodes.
      * @param currentLevel The current game level (affects scaling costs).
-     * @param nodes A vector of pointers to the nodes to check.
+     * @param nodes The nodes to check (any vector of Node* converts implicitly).
      * @param onNodeDamaged A callback function invoked when a node takes damage.
      * Provides the damaged node and the calculated health cost.
      */
     virtual void ProcessDamageZone(
-        float centerX,
-        float centerY,
+        const Position& from,
+        const Position& to,
         float zoneSize,
         float damage,
         int currentLevel,
-        const std::vector<Node*>& nodes,
+        Span<Node* const> nodes,
         std::function<void(Node*, float)> onNodeDamaged) = 0;
 
     /**
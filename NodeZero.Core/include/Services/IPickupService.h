@@ -54,12 +54,13 @@ class IPickupService {
     virtual int GetPickupPoints() const = 0;
 
     /**
-     * @brief Checks for pickups within a specific area and collects them.
-     * * @param mouseX The X coordinate of the collection center (e.g., mouse cursor).
-     * @param mouseY The Y coordinate of the collection center.
+     * @brief Collects every pickup the collection area touched while moving from one cursor position to the next.
+     * Testing the whole path keeps collection independent of the frame and tick rate.
+     * * @param from The collection center at the previous update (e.g., last mouse position).
+     * @param to The collection center now; pass `from` to test a single position.
      * @param damageZoneSize The width/height of the collection area.
      * @param collectedPickups Output vector that will be filled with the collected items.
      */
-    virtual void ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
+    virtual void ProcessPickupCollection(const Position& from, const Position& to, float damageZoneSize,
                                          std::vector<PointPickup>& collectedPickups) = 0;
 };
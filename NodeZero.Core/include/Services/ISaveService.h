@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "Types/SaveData.h"
 
 
@@ -15,7 +17,7 @@ class ISaveService {
     virtual ~ISaveService() = default;
 
     /**
-     * @brief Loads game progress from the disk.
+     * @brief Returns the game progress as last read from or written to the disk.
      * @return A SaveData structure containing the loaded values, or defaults if no save exists.
      */
     virtual SaveData LoadProgress() = 0;
@@ -40,4 +42,10 @@ class ISaveService {
     * @brief Returns the full cached save data object.
     */
     virtual SaveData GetCurrentData() const = 0;
+
+    /**
+     * @brief Returns the per-user data directory the save file lives in (created if missing).
+     * Other persistent files, such as generated caches, belong here too. Ends with a path separator.
+     */
+    virtual std::string GetDataDirectory() const = 0;
 };
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Events/GameEvents.h"
+#include "Types/PointPickup.h"
+#include "Types/Position.h"
+#include "Types/RenderView.h"
+
+/**
+ * @struct HudSnapshot
+ * @brief The values the gameplay HUD and debug overlay show.
+ */
+struct HudSnapshot {
+    float health{ 0.0f };
+    float maxHealth{ 0.0f };
+    int points{ 0 };
+    int level{ 1 };
+    float levelProgress{ 0.0f }; // Progress bar percentage
+    float damageZoneSize{ 0.0f };
+    int liveNodes{ 0 };
+    int peakNodes{ 0 };
+};
+
+/**
+ * @struct GameSnapshot
+ * @brief Everything the renderer needs from one simulation tick.
+ *
+ * Produced by SimulationThread and read on the render thread, so it only holds
+ * values: no pointers back into the Game. Treat it as immutable once acquired.
+ */
+struct GameSnapshot {
+    /** @brief Ticks simulated since the thread was created (0 for a snapshot taken without ticking). */
+    uint64_t tick{ 0 };
+
+    /** @brief Mouse position the tick's damage zone and pickup collection used. */
+    Position mouse;
+
+    std::vector<NodeRenderData> nodes; // Active nodes only, copied from IGame::GetRenderView()
+    std::vector<PointPickup> pickups;
+    HudSnapshot hud;
+
+    bool healthDepleted{ false };
+    bool levelCompleted{ false };
+
+    /**
+     * @brief Events not yet delivered to the consumer, oldest first.
+     * Includes EventType::PickupCollected for every pickup collected. Events of ticks
+     * whose snapshots were never acquired are carried over, up to a cap of
+     * SimulationThread::MAX_PENDING_EVENTS; past it the oldest are dropped and counted
+     * in droppedEvents. The HUD values and the healthDepleted/levelCompleted flags are
+     * state, not events, so they stay correct either way.
+     */
+    std::vector<GameEvent> events;
+
+    /** @brief Sequence number of events[0]; consecutive events count up from it. */
+    uint64_t firstEventSequence{ 0 };
+
+    /** @brief Events dropped so far because the consumer fell behind by more than the cap. */
+    uint64_t droppedEvents{ 0 };
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Events/GameEvents.h"
+#include "Simulation/GameSnapshot.h"
+#include "Simulation/TripleBuffer.h"
+#include "Types/Position.h"
+
+class IGame;
+class EventCollector;
+
+/**
+ * @class SimulationThread
+ * @brief Runs IGame::Update on its own thread at a fixed tick and publishes a GameSnapshot after each tick.
+ *
+ * Snapshots reach the render thread through a TripleBuffer and the mouse position
+ * travels the other way through an atomic latest-value slot, so neither thread ever
+ * blocks the other while the simulation runs.
+ *
+ * The Game itself is not thread-safe. It belongs to the simulation thread between
+ * Resume() and Pause(); outside that window (menus, level transitions, saving) the
+ * thread is idle and the caller may use the Game directly.
+ */
+class SimulationThread {
+public:
+    static constexpr size_t MAX_PENDING_EVENTS = 4096; // Undelivered events kept; the oldest are dropped past it
+
+    /** @param tickRate Simulation ticks per second. */
+    explicit SimulationThread(IGame& game, float tickRate);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /** @brief Creates the thread, idle until Resume(). */
+    void Start();
+
+    /** @brief Ends and joins the thread. Called by the destructor. */
+    void Stop();
+
+    /**
+     * @brief Publishes a snapshot of the current game state, then starts ticking.
+     * The snapshot shows changes made to the Game while paused straight away.
+     */
+    void Resume();
+
+    /**
+     * @brief Stops ticking; returns once the thread is idle and the Game is safe to use.
+     * The thread also stops by itself after the tick that ends the game or completes the level.
+     */
+    void Pause();
+
+    bool IsTicking() const;
+
+    /**
+     * @brief Runs one tick on the calling thread and publishes its snapshot.
+     * For headless runs and tests; only while the thread is not ticking.
+     */
+    void Step();
+
+    /** @brief Latest cursor position; the next tick starts from it. Callable from any thread. */
+    void SetMousePosition(float x, float y);
+
+    // --- Render thread ---
+
+    /**
+     * @brief Takes the newest snapshot, if one was published since the last call.
+     * Afterwards the snapshot's events are exactly those not delivered before.
+     * @return False if there was no new snapshot (the previous one stays, with no events).
+     */
+    bool AcquireSnapshot();
+
+    /** @brief The snapshot taken by the last AcquireSnapshot(); valid until the next one. */
+    const GameSnapshot& GetSnapshot() const;
+
+private:
+    void Run();
+
+    /** @return True once the game is over or the level is completed. */
+    bool Tick();
+
+    /** @brief Fills the write buffer from the Game and hands it to the render thread. */
+    void PublishSnapshot();
+
+    IGame& m_Game;
+    std::chrono::steady_clock::duration m_TickPeriod;
+    float m_TickDelta; // Seconds, passed to IGame::Update
+
+    std::thread m_Thread;
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_Ticking{ false };  // Guarded by m_Mutex
+    bool m_InTick{ false };   // Guarded by m_Mutex; Pause() waits for it to clear
+    bool m_Stopping{ false }; // Guarded by m_Mutex
+
+    // Render thread -> simulation
+    std::atomic<Position> m_Mouse{ Position{ 0.0f, 0.0f } };
+
+    // Simulation -> render thread
+    TripleBuffer<GameSnapshot> m_Snapshots;
+    std::atomic<uint64_t> m_DeliveredEvents{ 0 }; // Sequence number of the first undelivered event
+
+    // Producer side: events since the oldest undelivered one, collected from the Game's notifications
+    std::shared_ptr<EventCollector> m_Collector;
+    std::vector<GameEvent> m_PendingEvents;
+    uint64_t m_PendingFirstSequence{ 0 };
+    uint64_t m_DroppedEvents{ 0 };
+    uint64_t m_Tick{ 0 };
+
+    // Consumer side
+    uint64_t m_ConsumedEvents{ 0 };
+
+    static_assert(std::atomic<Position>::is_always_lock_free, "The mouse slot must not take a lock");
+
+    static constexpr int MAX_CATCH_UP_TICKS = 8; // Further behind than this, the clock skips ahead
+};
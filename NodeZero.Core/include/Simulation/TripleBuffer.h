@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Lock-free single-producer/single-consumer hand-off of the latest value.
+ *
+ * The producer writes into its back buffer and publishes it; the consumer acquires
+ * the most recently published buffer and reads it until its next acquire. The three
+ * buffers rotate through one atomic index swap, so neither side ever waits for the
+ * other. Values published faster than they are acquired are overwritten (latest wins),
+ * and buffers are reused, so containers inside T keep their capacity between writes.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // --- Producer ---
+
+    /** @brief The buffer to fill next. Still holds whatever was written into it two publishes ago. */
+    T& GetWriteBuffer() {
+        return m_Buffers[m_Back];
+    }
+
+    /**
+     * @brief Makes the write buffer the latest value and takes a free buffer to write next.
+     * @return True if the previous value was replaced before the consumer acquired it.
+     */
+    bool Publish() {
+        uint8_t previous = m_Middle.exchange(static_cast<uint8_t>(m_Back | FRESH_BIT), std::memory_order_acq_rel);
+        m_Back = previous & INDEX_MASK;
+        return (previous & FRESH_BIT) != 0;
+    }
+
+    // --- Consumer ---
+
+    /**
+     * @brief Switches the read buffer to the latest published value, if there is a new one.
+     * @return False if nothing was published since the last acquire (the read buffer is unchanged).
+     */
+    bool Acquire() {
+        if ((m_Middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+
+        uint8_t previous = m_Middle.exchange(m_Front, std::memory_order_acq_rel);
+        m_Front = previous & INDEX_MASK;
+        return true;
+    }
+
+    /** @brief The acquired value; owned by the consumer until its next Acquire(). */
+    T& GetReadBuffer() {
+        return m_Buffers[m_Front];
+    }
+
+    const T& GetReadBuffer() const {
+        return m_Buffers[m_Front];
+    }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH_BIT = 0x4; // Set on publish, cleared when the consumer takes it
+
+    static_assert(std::atomic<uint8_t>::is_always_lock_free, "TripleBuffer needs a lock-free byte atomic");
+
+    std::array<T, 3> m_Buffers{};
+
+    // Index of the buffer between the two sides; the only state they share
+    alignas(64) std::atomic<uint8_t> m_Middle{ 1 };
+
+    alignas(64) uint8_t m_Back{ 0 };  // Producer only
+    alignas(64) uint8_t m_Front{ 2 }; // Consumer only
+};
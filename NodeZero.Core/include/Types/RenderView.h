@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Enums/NodeShape.h"
+#include "Types/PointPickup.h"
+#include "Types/Position.h"
+#include "Types/Span.h"
+
+/**
+ * @struct NodeRenderData
+ * @brief Draw-ready state of one active node: plain data, read without any virtual calls.
+ */
+struct NodeRenderData {
+    Position position;
+    float size{ 0.0f };
+    float rotation{ 0.0f };
+    float hpRatio{ 1.0f }; // Current HP / max HP, for the fill
+    NodeShape shape{ NodeShape::Circle };
+};
+
+/**
+ * @struct RenderView
+ * @brief Contiguous arrays of everything drawn from the game, filled at most once per tick.
+ *
+ * Points into the game's own storage: valid until the game is next updated or reset.
+ */
+struct RenderView {
+    Span<const NodeRenderData> nodes; // Active nodes only
+    Span<const PointPickup> pickups;
+    Span<const PointPickup> collectedPickups; // Collected during the last update
+};
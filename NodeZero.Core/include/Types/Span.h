@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct Span
+ * @brief Non-owning view of a contiguous array (a C++17 stand-in for std::span).
+ *
+ * Valid only as long as the storage it points into is neither freed nor resized.
+ */
+template <typename T>
+struct Span {
+    T* data{ nullptr };
+    size_t size{ 0 };
+
+    Span() = default;
+    Span(T* data, size_t size) : data(data), size(size) {}
+
+    /** @brief Views a vector's current elements, whatever its allocator. */
+    template <typename U, typename Allocator>
+    Span(const std::vector<U, Allocator>& vector) : data(vector.data()), size(vector.size()) {}
+
+    T* begin() const { return data; }
+    T* end() const { return data + size; }
+    T& operator[](size_t index) const { return data[index]; }
+    bool empty() const { return size == 0; }
+};
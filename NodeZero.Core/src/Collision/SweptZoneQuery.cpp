@@ -0,0 +1,98 @@
+#include "Collision/SweptZoneQuery.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/**
+ * @brief Separating-axis test of the segment a-b against the box of half-extents (extentX, extentY) at the origin.
+ * The only candidate axes are x, y and the segment's normal; |cross| is the segment's distance
+ * along that normal times its length, as are the box's projections absDx and absDy.
+ */
+inline bool SegmentHitsBox(float ax, float ay, float bx, float by, float extentX, float extentY,
+    float cross, float absDx, float absDy) {
+    const bool separatedX = ((ax > extentX) & (bx > extentX)) | ((ax < -extentX) & (bx < -extentX));
+    const bool separatedY = ((ay > extentY) & (by > extentY)) | ((ay < -extentY) & (by < -extentY));
+    const bool separatedNormal = cross > extentX * absDy + extentY * absDx;
+    return !(separatedX | separatedY | separatedNormal);
+}
+
+/**
+ * @brief Whether the point (px, py) lies within sqrt(rSquared) of the segment a-b with direction (dx, dy).
+ * Either end is close enough, or the point projects inside the segment and is close to its line.
+ * Written as comparisons only: selects (a clamp) would keep the loop from vectorising.
+ */
+inline bool SegmentNearPoint(float px, float py, float ax, float ay, float bx, float by,
+    float dx, float dy, float lengthSquared, float rSquared) {
+    const float toAX = px - ax;
+    const float toAY = py - ay;
+    const float toBX = px - bx;
+    const float toBY = py - by;
+    const bool nearA = toAX * toAX + toAY * toAY <= rSquared;
+    const bool nearB = toBX * toBX + toBY * toBY <= rSquared;
+
+    const float along = toAX * dx + toAY * dy;
+    const float across = toAX * dy - toAY * dx;
+    const bool nearLine = (along > 0.0f) & (along < lengthSquared) & (across * across <= rSquared * lengthSquared);
+    return nearA | nearB | nearLine;
+}
+
+} // namespace
+
+void SweptZoneQuery::Clear() {
+    m_X.clear();
+    m_Y.clear();
+    m_HalfSize.clear();
+    m_Radius.clear();
+}
+
+void SweptZoneQuery::Add(const Position& center, float halfSize, float radius) {
+    m_X.push_back(center.x);
+    m_Y.push_back(center.y);
+    m_HalfSize.push_back(halfSize);
+    m_Radius.push_back(radius);
+}
+
+void SweptZoneQuery::Run(const Position& from, const Position& to, float zoneSize) {
+    const size_t count = m_X.size();
+    m_Hits.resize(count);
+
+    const float zoneHalf = zoneSize / 2.0f;
+    const float dx = to.x - from.x;
+    const float dy = to.y - from.y;
+    const float absDx = std::fabs(dx);
+    const float absDy = std::fabs(dy);
+    const float lengthSquared = dx * dx + dy * dy;
+
+    const float* x = m_X.data();
+    const float* y = m_Y.data();
+    const float* halfSize = m_HalfSize.data();
+    const float* radius = m_Radius.data();
+    uint32_t* hits = m_Hits.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        // The zone's center path, relative to the target
+        const float ax = from.x - x[i];
+        const float ay = from.y - y[i];
+        const float bx = ax + dx;
+        const float by = ay + dy;
+        const float cross = std::fabs(dx * ay - dy * ax);
+
+        // Target grown by the zone: a box of half-size `extent` with corners rounded by `r`
+        const float extent = zoneHalf + halfSize[i];
+        const float r = radius[i];
+
+        const bool hitsWide = SegmentHitsBox(ax, ay, bx, by, extent + r, extent, cross, absDx, absDy);
+        const bool hitsTall = SegmentHitsBox(ax, ay, bx, by, extent, extent + r, cross, absDx, absDy);
+
+        const float rSquared = r * r;
+        const bool hitsCorner =
+            SegmentNearPoint(extent, extent, ax, ay, bx, by, dx, dy, lengthSquared, rSquared) |
+            SegmentNearPoint(-extent, extent, ax, ay, bx, by, dx, dy, lengthSquared, rSquared) |
+            SegmentNearPoint(extent, -extent, ax, ay, bx, by, dx, dy, lengthSquared, rSquared) |
+            SegmentNearPoint(-extent, -extent, ax, ay, bx, by, dx, dy, lengthSquared, rSquared);
+
+        hits[i] = static_cast<uint32_t>(hitsWide | hitsTall | hitsCorner);
+    }
+}
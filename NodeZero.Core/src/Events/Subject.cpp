@@ -1,5 +1,7 @@
 #include "Events/Subject.h"
 
+#include <algorithm>
+
 void Subject::Attach(std::shared_ptr<IObserver> observer) {
     if (!observer) {
         return;
@@ -11,22 +13,38 @@ void Subject::Detach(std::shared_ptr<IObserver> observer) {
     if (!observer) {
         return;
     }
-    m_observers.remove(observer);
-}
 
-void Subject::Notify(const std::shared_ptr<IEvent>& event) {
-    if (!event) {
+    // Mid-notification the slots must not move; they are compacted once it ends
+    if (m_notifyDepth > 0) {
+        for (auto& slot : m_observers) {
+            if (slot == observer) {
+                slot = nullptr;
+                m_hasDetached = true;
+            }
+        }
         return;
     }
 
-    // Refactor Note: We create a copy of the list before iterating.
-    // Why? If an Observer decides to call Detach() inside its Update() method,
-    // iterating over the original 'm_observers' while modifying it would crash the program.
-    auto observersCopy = m_observers;
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
 
-    for (const auto& observer : observersCopy) {
+void Subject::Notify(const IEvent& event) {
+    // Refactor Note: Iterates the list in place instead of over a copy, so an event costs no allocation.
+    // Observers attached during the loop sit past `count` and get the next event; detached ones are
+    // nulled out by Detach() and skipped. The local shared_ptr keeps an observer alive while it runs,
+    // even if it detaches itself.
+    ++m_notifyDepth;
+    const size_t count = m_observers.size();
+    for (size_t i = 0; i < count; ++i) {
+        std::shared_ptr<IObserver> observer = m_observers[i];
         if (observer) {
             observer->Update(event);
         }
     }
+    --m_notifyDepth;
+
+    if (m_notifyDepth == 0 && m_hasDetached) {
+        m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), nullptr), m_observers.end());
+        m_hasDetached = false;
+    }
 }
\ No newline at end of file
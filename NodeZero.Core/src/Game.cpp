@@ -2,22 +2,30 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
 #include <ctime>
 
 #include "Config/GameConfig.h"
 #include "Events/GameEvents.h"
+#include "Memory/ArenaAllocator.h"
 
 Game::Game()
     : m_ScreenWidth(0.0f),
     m_ScreenHeight(0.0f),
     m_ElapsedTime(0.0f),
     m_NodesDestroyed(0),
+    m_NodesDespawned(0),
+    m_PeakNodeCount(0),
     m_HighPoints(0),
     m_Boss(nullptr),
     m_MouseX(0.0f),
-    m_MouseY(0.0f) {
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    m_MouseY(0.0f),
+    m_PreviousMouseX(0.0f),
+    m_PreviousMouseY(0.0f),
+    m_HasMouseTrail(false),
+    m_RenderViewDirty(true),
+    m_Random(static_cast<unsigned int>(std::time(nullptr))) {
+    m_SpawnService.SetRandomEngine(&m_Random);
+    m_PickupService.SetRandomEngine(&m_Random);
 
     SaveData saveData = m_SaveService.LoadProgress();
     m_HighPoints = saveData.highPoints;
@@ -50,8 +58,19 @@ void Game::Initialize(float screenWidth, float screenHeight) {
 // -----------------------------------------------------------------------------
 
 void Game::Update(float deltaTime) {
+    // Nothing allocated from the arena during the previous tick is still in use
+    m_FrameArena.Reset();
     m_CollectedPickupsThisFrame.clear();
 
+    // The zone covers the whole path since the last update, so fast cursor moves miss nothing
+    if (!m_HasMouseTrail) {
+        m_PreviousMouseX = m_MouseX;
+        m_PreviousMouseY = m_MouseY;
+        m_HasMouseTrail = true;
+    }
+    const Position zoneFrom{ m_PreviousMouseX, m_PreviousMouseY };
+    const Position zoneTo{ m_MouseX, m_MouseY };
+
     // Update Services
     m_HealthService.Update(deltaTime);
     m_HealthService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
@@ -59,19 +78,30 @@ void Game::Update(float deltaTime) {
 
     // Logic Steps
     HandleSpawning(deltaTime);
-    HandleDamageZones(deltaTime);
+    HandleDamageZones(deltaTime, zoneFrom, zoneTo);
 
     // Pickups
     m_CollectedPickupsThisFrame.clear();
     m_PickupService.ProcessPickupCollection(
-        m_MouseX, m_MouseY, m_UpgradeService.GetDamageZoneSize(), m_CollectedPickupsThisFrame
+        zoneFrom, zoneTo, m_UpgradeService.GetDamageZoneSize(), m_CollectedPickupsThisFrame
     );
+    for (const PointPickup& pickup : m_CollectedPickupsThisFrame) {
+        GameEvent event(m_ElapsedTime, EventType::PickupCollected);
+        event.position = pickup.position;
+        event.size = pickup.size;
+        event.points = pickup.points;
+        Notify(event);
+    }
     m_PickupService.Update(deltaTime);
 
     // Update Entities and check for deaths
     UpdateNodes(deltaTime);
 
+    m_PreviousMouseX = m_MouseX;
+    m_PreviousMouseY = m_MouseY;
+
     m_ElapsedTime += deltaTime;
+    m_RenderViewDirty = true;
 }
 
 // -----------------------------------------------------------------------------
@@ -93,7 +123,7 @@ void Game::HandleSpawning(float deltaTime) {
     }
 }
 
-void Game::HandleDamageZones(float deltaTime) {
+void Game::HandleDamageZones(float deltaTime, const Position& zoneFrom, const Position& zoneTo) {
     m_DamageZoneService.UpdateTimer(deltaTime);
 
     if (m_DamageZoneService.ShouldDealDamage()) {
@@ -101,21 +131,22 @@ void Game::HandleDamageZones(float deltaTime) {
 
         // Lambda to handle what happens when a specific node gets hit
         auto onNodeDamaged = [this](INode* node, float healthCost) {
-            auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeDamaged);
-            event->position = node->GetPosition();
-            event->damage = static_cast<int>(m_UpgradeService.GetDamagePerTick());
-            event->hp = static_cast<int>(node->GetHP());
+            GameEvent event(m_ElapsedTime, EventType::NodeDamaged);
+            event.position = node->GetPosition();
+            event.damage = static_cast<int>(m_UpgradeService.GetDamagePerTick());
+            event.hp = static_cast<int>(node->GetHP());
             Notify(event);
 
             m_HealthService.Reduce(healthCost);
             };
 
-        std::vector<Node*> castedNodes;
+        ArenaVector<Node*> castedNodes{ ArenaAllocator<Node*>(m_FrameArena) };
+        castedNodes.reserve(m_Nodes.size());
         for (auto* n : m_Nodes) castedNodes.push_back(dynamic_cast<Node*>(n));
 
         m_DamageZoneService.ProcessDamageZone(
-            m_MouseX,
-            m_MouseY,
+            zoneFrom,
+            zoneTo,
             m_UpgradeService.GetDamageZoneSize(),
             m_UpgradeService.GetDamagePerTick(),
             m_LevelService.GetCurrentLevel(),
@@ -133,9 +164,8 @@ void Game::UpdateNodes(float deltaTime) {
         [this](INode* node) {
             bool isBoss = node->GetShape() == NodeShape::Boss;
 
-            // Logic: Remove if Dead OR Offscreen (unless it's the boss)
-            bool isOffScreen = node->GetPosition().x < -200.0f;
-            if (isBoss) isOffScreen = false;
+            // Logic: Remove if Dead OR past the despawn margin on any side (unless it's the boss)
+            bool isOffScreen = !isBoss && IsOutsidePlayArea(node);
 
             bool shouldRemove = node->GetState() == NodeState::Dead || isOffScreen;
 
@@ -143,9 +173,9 @@ void Game::UpdateNodes(float deltaTime) {
                 if (node->GetState() == NodeState::Dead) {
                     if (isBoss) {
                         int pointsGained = 500 * m_LevelService.GetCurrentLevel();
-                        auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::BossDefeated);
-                        event->level = m_LevelService.GetCurrentLevel();
-                        event->points = pointsGained;
+                        GameEvent event(m_ElapsedTime, EventType::BossDefeated);
+                        event.level = m_LevelService.GetCurrentLevel();
+                        event.points = pointsGained;
                         Notify(event);
 
                         m_LevelService.SetBossActive(false);
@@ -153,10 +183,10 @@ void Game::UpdateNodes(float deltaTime) {
                         m_LevelService.SetLevelCompleted(true);
                     }
                     else {
-                        auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeDestroyed);
-                        event->shape = node->GetShape();
-                        event->position = node->GetPosition();
-                        event->points = 100;
+                        GameEvent event(m_ElapsedTime, EventType::NodeDestroyed);
+                        event.shape = node->GetShape();
+                        event.position = node->GetPosition();
+                        event.points = 100;
                         Notify(event);
 
                         m_PickupService.SpawnPointPickups(node->GetPosition());
@@ -164,6 +194,9 @@ void Game::UpdateNodes(float deltaTime) {
                         m_LevelService.IncrementNodesDestroyed();
                     }
                 }
+                else {
+                    m_NodesDespawned++;
+                }
                 delete node;
             }
             return shouldRemove;
@@ -172,6 +205,14 @@ void Game::UpdateNodes(float deltaTime) {
     m_Nodes.erase(it, m_Nodes.end());
 }
 
+bool Game::IsOutsidePlayArea(const INode* node) const {
+    const float margin = GameConfig::NODE_DESPAWN_MARGIN;
+    const Position& position = node->GetPosition();
+
+    return position.x < -margin || position.x > m_ScreenWidth + margin ||
+        position.y < -margin || position.y > m_ScreenHeight + margin;
+}
+
 // -----------------------------------------------------------------------------
 // Getters / Setters
 // -----------------------------------------------------------------------------
@@ -183,11 +224,43 @@ const std::vector<INode*>& Game::GetNodes() const {
     return m_Nodes;
 }
 
+RenderView Game::GetRenderView() const {
+    if (m_RenderViewDirty) {
+        m_NodeRenderData.clear();
+        for (const INode* node : m_Nodes) {
+            if (node->GetState() != NodeState::Active) continue;
+
+            NodeRenderData data;
+            data.position = node->GetPosition();
+            data.size = node->GetSize();
+            data.rotation = node->GetRotation();
+            data.hpRatio = node->GetHP() / node->GetMaxHP();
+            data.shape = node->GetShape();
+            m_NodeRenderData.push_back(data);
+        }
+        m_RenderViewDirty = false;
+    }
+
+    RenderView view;
+    view.nodes = m_NodeRenderData;
+    view.pickups = m_PickupService.GetPickups();
+    view.collectedPickups = m_CollectedPickupsThisFrame;
+    return view;
+}
+
 void Game::SetMousePosition(float x, float y) {
     m_MouseX = x;
     m_MouseY = y;
 }
 
+void Game::ResetMouseTrail() {
+    m_HasMouseTrail = false;
+}
+
+void Game::SeedRandom(unsigned int seed) {
+    m_Random.seed(seed);
+}
+
 // -----------------------------------------------------------------------------
 // Entity Creation
 // -----------------------------------------------------------------------------
@@ -203,12 +276,14 @@ void Game::SpawnNode(const SpawnInfo& info) {
     node->Spawn(info.position.x, info.position.y);
     node->SetDirection(info.directionX, info.directionY);
     m_Nodes.push_back(node);
-
-    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeSpawned);
-    event->shape = node->GetShape();
-    event->position = info.position;
-    event->size = node->GetSize();
-    event->hp = static_cast<int>(node->GetHP());
+    m_PeakNodeCount = std::max(m_PeakNodeCount, static_cast<int>(m_Nodes.size()));
+    m_RenderViewDirty = true;
+
+    GameEvent event(m_ElapsedTime, EventType::NodeSpawned);
+    event.shape = node->GetShape();
+    event.position = info.position;
+    event.size = node->GetSize();
+    event.hp = static_cast<int>(node->GetHP());
     Notify(event);
 }
 
@@ -222,14 +297,15 @@ void Game::SpawnBoss() {
     m_Boss->SetHP(bossHP);
 
     float spawnX, spawnY;
-    int edge = std::rand() % 4;
+    int edge = std::uniform_int_distribution<int>(0, 3)(m_Random);
     float offset = bossSize * 1.5f;
+    float along = std::uniform_real_distribution<float>(0.0f, 1.0f)(m_Random);
 
     switch (edge) {
-    case 0: spawnX = (float)rand() / RAND_MAX * m_ScreenWidth; spawnY = -offset; break;
-    case 1: spawnX = m_ScreenWidth + offset; spawnY = (float)rand() / RAND_MAX * m_ScreenHeight; break;
-    case 2: spawnX = (float)rand() / RAND_MAX * m_ScreenWidth; spawnY = m_ScreenHeight + offset; break;
-    case 3: spawnX = -offset; spawnY = (float)rand() / RAND_MAX * m_ScreenHeight; break;
+    case 0: spawnX = along * m_ScreenWidth; spawnY = -offset; break;
+    case 1: spawnX = m_ScreenWidth + offset; spawnY = along * m_ScreenHeight; break;
+    case 2: spawnX = along * m_ScreenWidth; spawnY = m_ScreenHeight + offset; break;
+    case 3: spawnX = -offset; spawnY = along * m_ScreenHeight; break;
     }
 
     m_Boss->Spawn(spawnX, spawnY);
@@ -244,11 +320,12 @@ void Game::SpawnBoss() {
 
     m_Boss->SetDirection(dirX, dirY);
     m_Nodes.push_back(m_Boss);
+    m_PeakNodeCount = std::max(m_PeakNodeCount, static_cast<int>(m_Nodes.size()));
     m_LevelService.SetBossActive(true);
 
-    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::BossSpawned);
-    event->level = m_LevelService.GetCurrentLevel();
-    event->bossHP = bossHP;
+    GameEvent event(m_ElapsedTime, EventType::BossSpawned);
+    event.level = m_LevelService.GetCurrentLevel();
+    event.bossHP = bossHP;
     Notify(event);
 }
 
@@ -270,6 +347,8 @@ void Game::Reset() {
     m_PickupService.Reset();
     m_HealthService.Reset(m_UpgradeService.GetMaxHealth());
     m_NodesDestroyed = 0;
+    m_NodesDespawned = 0;
+    m_PeakNodeCount = 0;
     m_SpawnService.ResetSpawnTimer();
     m_DamageZoneService.ResetTimer();
 
@@ -277,6 +356,9 @@ void Game::Reset() {
     m_LevelService.Reset(saveData.currentLevel);
 
     m_Boss = nullptr;
+    m_CollectedPickupsThisFrame.clear();
+    m_HasMouseTrail = false;
+    m_RenderViewDirty = true;
 }
 
 void Game::StartNextLevel() {
@@ -295,10 +377,13 @@ void Game::StartNextLevel() {
     m_SpawnService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
     m_HealthService.RestoreToMax();
     m_Boss = nullptr;
+    m_CollectedPickupsThisFrame.clear();
+    m_HasMouseTrail = false;
+    m_RenderViewDirty = true;
 
-    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::LevelCompleted);
-    event->level = oldLevel;
-    event->nextLevel = m_LevelService.GetCurrentLevel();
+    GameEvent event(m_ElapsedTime, EventType::LevelCompleted);
+    event.level = oldLevel;
+    event.nextLevel = m_LevelService.GetCurrentLevel();
     Notify(event);
 }
 
@@ -323,8 +408,10 @@ void Game::SaveProgress() {
 }
 
 int Game::GetNodesDestroyed() const { return m_NodesDestroyed; }
+int Game::GetLiveNodeCount() const { return static_cast<int>(m_Nodes.size()); }
+int Game::GetPeakNodeCount() const { return m_PeakNodeCount; }
+int Game::GetNodesDespawned() const { return m_NodesDespawned; }
 int Game::GetHighPoints() const { return m_HighPoints; }
-std::vector<PointPickup> Game::GetCollectedPickupsThisFrame() const { return m_CollectedPickupsThisFrame; }
 
 IUpgradeService& Game::GetUpgradeService() { return m_UpgradeService; }
 IPickupService& Game::GetPickupService() { return m_PickupService; }
@@ -336,4 +423,4 @@ ISaveService& Game::GetSaveService() { return m_SaveService; }
 
 void Game::Attach(std::shared_ptr<IObserver> observer) { m_Subject.Attach(observer); }
 void Game::Detach(std::shared_ptr<IObserver> observer) { m_Subject.Detach(observer); }
-void Game::Notify(const std::shared_ptr<IEvent>& event) { m_Subject.Notify(event); }
\ No newline at end of file
+void Game::Notify(const IEvent& event) { m_Subject.Notify(event); }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "Events/Subject.h"
 #include "IGame.h"
+#include "Memory/FrameArena.h"
 #include "Node.h"
 #include "Services/DamageZoneService.h"
 #include "Services/HealthService.h"
@@ -34,14 +36,31 @@ private:
     float m_ElapsedTime;
 
     int m_NodesDestroyed;
+    int m_NodesDespawned;   // Left the play area without being destroyed
+    int m_PeakNodeCount;    // Highest m_Nodes size since the last Reset
     int m_HighPoints;
 
     INode* m_Boss; // Stored as generic interface
 
     float m_MouseX;
     float m_MouseY;
+
+    // Where the previous Update left the zone; the next one sweeps from here
+    float m_PreviousMouseX;
+    float m_PreviousMouseY;
+    bool m_HasMouseTrail;
     std::vector<PointPickup> m_CollectedPickupsThisFrame;
 
+    // Scratch memory for one tick (damage candidates), reset at the top of Update()
+    FrameArena m_FrameArena;
+
+    // Filled from m_Nodes on the first GetRenderView() after a change
+    mutable std::vector<NodeRenderData> m_NodeRenderData;
+    mutable bool m_RenderViewDirty;
+
+    // Every random draw of the simulation (spawns, pickups, boss), used only by the thread running Update()
+    std::mt19937 m_Random;
+
     UpgradeService m_UpgradeService;
     PickupService m_PickupService;
     HealthService m_HealthService;
@@ -51,7 +70,6 @@ private:
     SaveService m_SaveService;
 
 	// Refactor: No magic numbers, turned into constants
-    static constexpr float BOSS_OFFSCREEN_LIMIT = -200.0f;
     static constexpr int POINTS_BOSS = 500;
     static constexpr int POINTS_NODE = 100;
 
@@ -65,15 +83,22 @@ public:
     void StartNextLevel() override;
 
     void SetMousePosition(float x, float y) override;
+    void ResetMouseTrail() override;
+
+    /** @brief Restarts the simulation's random sequence, so a run can be replayed exactly. */
+    void SeedRandom(unsigned int seed);
     void SpawnNode(const SpawnInfo& info) override;
 
     float GetScreenWidth() const override;
     float GetScreenHeight() const override;
 
     const std::vector<INode*>& GetNodes() const override;
-    std::vector<PointPickup> GetCollectedPickupsThisFrame() const override;
+    RenderView GetRenderView() const override;
 
     int GetNodesDestroyed() const override;
+    int GetLiveNodeCount() const override;
+    int GetPeakNodeCount() const override;
+    int GetNodesDespawned() const override;
     void SaveProgress() override;
     int GetHighPoints() const override;
 
@@ -89,7 +114,7 @@ public:
     // Observer Pattern
     void Attach(std::shared_ptr<IObserver> observer) override;
     void Detach(std::shared_ptr<IObserver> observer) override;
-    void Notify(const std::shared_ptr<IEvent>& event) override;
+    void Notify(const IEvent& event) override;
 
 private:
     INode* CreateNode(NodeShape shape, float size, float speed);
@@ -97,6 +122,7 @@ private:
 
     // Refactor: Breaking down Update loop
     void HandleSpawning(float deltaTime);
-    void HandleDamageZones(float deltaTime);
+    void HandleDamageZones(float deltaTime, const Position& zoneFrom, const Position& zoneTo);
     void UpdateNodes(float deltaTime);
+    bool IsOutsidePlayArea(const INode* node) const;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "Memory/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+FrameArena::FrameArena(size_t blockSize)
+    : m_BlockSize(std::max<size_t>(blockSize, 1)) {
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+    while (true) {
+        if (m_Current < m_Blocks.size()) {
+            Block& block = m_Blocks[m_Current];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+            uintptr_t aligned = (base + m_Offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+            size_t start = static_cast<size_t>(aligned - base);
+
+            if (start <= block.size && size <= block.size - start) {
+                m_Offset = start + size;
+                return block.data.get() + start;
+            }
+
+            // Does not fit: move on to the next block, keeping this one's tail unused until the reset
+            m_UsedBefore += block.size;
+            ++m_Current;
+            m_Offset = 0;
+            continue;
+        }
+
+        // Out of blocks: add one big enough for this request, whatever the alignment
+        Block block;
+        block.size = std::max(m_BlockSize, size + alignment);
+        block.data.reset(new unsigned char[block.size]);
+        m_Blocks.push_back(std::move(block));
+    }
+}
+
+void FrameArena::Reset() {
+    m_Current = 0;
+    m_Offset = 0;
+    m_UsedBefore = 0;
+}
+
+size_t FrameArena::GetUsed() const {
+    return m_UsedBefore + m_Offset;
+}
+
+size_t FrameArena::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : m_Blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
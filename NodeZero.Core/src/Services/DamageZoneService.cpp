@@ -1,8 +1,8 @@
 #include "DamageZoneService.h"
 
-#include <algorithm>
-#include <cmath>
+#include <utility>
 
+#include "Collision/NodeBounds.h"
 #include "Enums/NodeShape.h"
 #include "Enums/NodeState.h"
 #include "Node.h"
@@ -25,58 +25,62 @@ bool DamageZoneService::ShouldDealDamage() const {
 }
 
 void DamageZoneService::ProcessDamageZone(
-    float centerX,
-    float centerY,
+    const Position& from,
+    const Position& to,
     float zoneSize,
     float damage,
     int currentLevel,
-    const std::vector<Node*>& nodes,
+    Span<Node* const> nodes,
     std::function<void(Node*, float)> onNodeDamaged) {
 
-    float damageRectX = centerX - zoneSize / 2.0f;
-    float damageRectY = centerY - zoneSize / 2.0f;
-    float damageRectRight = damageRectX + zoneSize;
-    float damageRectBottom = damageRectY + zoneSize;
-
+    //Refactor: Active nodes are tested in one batched swept pass, then damaged in order
+    m_ZoneQuery.Clear();
+    m_Candidates.clear();
     for (Node* node : nodes) {
         if (node->GetState() != NodeState::Active)
             continue;
 
-        //Refactor: Logic extracted to helper method for readability
-        if (IsNodeInZone(node, damageRectX, damageRectY, damageRectRight, damageRectBottom)) {
+        m_ZoneQuery.Add(node->GetPosition(), 0.0f, GetBoundingRadius(node));
+        m_Candidates.push_back(node);
+    }
 
-            node->TakeDamage(damage);
+    if (m_Candidates.empty()) {
+        return;
+    }
 
-            //Refactor: Cost calculation extracted to helper method
-            float scaledHealthCost = CalculateDamageCost(node, currentLevel);
+    m_ZoneQuery.Run(from, to, zoneSize);
 
-            if (onNodeDamaged) {
-                onNodeDamaged(node, scaledHealthCost);
-            }
-        }
-    }
-}
+    for (size_t i = 0; i < m_Candidates.size(); ++i) {
+        if (!m_ZoneQuery.IsHit(i))
+            continue;
 
-bool DamageZoneService::IsNodeInZone(Node* node, float rectX, float rectY, float rectRight, float rectBottom) const {
-    const float nodeX = node->GetPosition().x;
-    const float nodeY = node->GetPosition().y;
-    const float nodeSize = node->GetSize();
+        Node* node = m_Candidates[i];
+        node->TakeDamage(damage);
 
-    float boundingRadius = nodeSize;
-    const NodeShape shape = node->GetShape();
+        //Refactor: Cost calculation extracted to helper method
+        float scaledHealthCost = CalculateDamageCost(node, currentLevel);
 
-    if (shape == NodeShape::Square || shape == NodeShape::Boss) {
-        boundingRadius = nodeSize * SQUARE_DIAGONAL_RATIO;
+        if (onNodeDamaged) {
+            onNodeDamaged(node, scaledHealthCost);
+        }
     }
+}
 
-    const float closestX = std::max(rectX, std::min(nodeX, rectRight));
-    const float closestY = std::max(rectY, std::min(nodeY, rectBottom));
+void DamageZoneService::ProcessDamageZone(
+    float centerX,
+    float centerY,
+    float zoneSize,
+    float damage,
+    int currentLevel,
+    Span<Node* const> nodes,
+    std::function<void(Node*, float)> onNodeDamaged) {
 
-    const float deltaX = nodeX - closestX;
-    const float deltaY = nodeY - closestY;
-    const float distanceSquared = (deltaX * deltaX) + (deltaY * deltaY);
+    Position center{ centerX, centerY };
+    ProcessDamageZone(center, center, zoneSize, damage, currentLevel, nodes, std::move(onNodeDamaged));
+}
 
-    return distanceSquared <= (boundingRadius * boundingRadius);
+float DamageZoneService::GetBoundingRadius(Node* node) const {
+    return NodeBounds::GetRadius(node->GetShape(), node->GetSize());
 }
 
 float DamageZoneService::CalculateDamageCost(Node* node, int currentLevel) const {
@@ -3,6 +3,7 @@
 #include <functional>
 #include <vector>
 
+#include "Collision/SweptZoneQuery.h"
 #include "Services/IDamageZoneService.h"
 
 class Node;
@@ -11,7 +12,7 @@ enum class NodeShape;
 /**
  * @class DamageZoneService
  * @brief Concrete implementation of the damage zone logic.
- * * Handles the logic for Rectangle-vs-Circle collision detection
+ * * Handles the logic for swept Rectangle-vs-Circle collision detection
  * and damage scaling calculations.
  */
 class DamageZoneService : public IDamageZoneService {
@@ -19,8 +20,11 @@ class DamageZoneService : public IDamageZoneService {
     float m_DamageTimer;
     float m_DamageInterval;
 
+    // Targets of the current pulse, reused between pulses
+    SweptZoneQuery m_ZoneQuery;
+    std::vector<Node*> m_Candidates;
+
 	//Refactor: No magic numbers, turned into constants
-    static constexpr float SQUARE_DIAGONAL_RATIO = 1.414f; // approx sqrt(2)
     static constexpr float BASE_HEALTH_COST = 0.5f;
     static constexpr float BOSS_COST_MULTIPLIER = 8.0f;
     static constexpr float LEVEL_SCALING_FACTOR = 0.20f;
@@ -33,20 +37,32 @@ class DamageZoneService : public IDamageZoneService {
     void ResetTimer() override;
     bool ShouldDealDamage() const override;
 
+    void ProcessDamageZone(
+        const Position& from,
+        const Position& to,
+        float zoneSize,
+        float damage,
+        int currentLevel,
+        Span<Node* const> nodes,
+        std::function<void(Node*, float)> onNodeDamaged) override;
+
+    /**
+     * @brief Applies the zone at a single position (no sweep).
+     */
     void ProcessDamageZone(
         float centerX,
         float centerY,
         float zoneSize,
         float damage,
         int currentLevel,
-        const std::vector<Node*>& nodes,
-        std::function<void(Node*, float)> onNodeDamaged) override;
+        Span<Node* const> nodes,
+        std::function<void(Node*, float)> onNodeDamaged);
 
     private:
     /**
-     * @brief Checks if a specific node is colliding with the damage rect.
+     * @brief Radius of the circle the zone test treats the node as.
      */
-    bool IsNodeInZone(Node* node, float rectX, float rectY, float rectRight, float rectBottom) const;
+    float GetBoundingRadius(Node* node) const;
 
     /**
      * @brief Calculates the resource cost/reward for damaging a node.
@@ -2,20 +2,24 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
 
 #include "Config/GameConfig.h"
 
 PickupService::PickupService()
     : m_NextPickupId(0),
     m_PickupPoints(0),
-    m_ScreenHeight(0.0f) {
+    m_ScreenHeight(0.0f),
+    m_Random(nullptr) {
 }
 
 void PickupService::Initialize(float screenHeight) {
     m_ScreenHeight = screenHeight;
 }
 
+void PickupService::SetRandomEngine(std::mt19937* random) {
+    m_Random = random;
+}
+
 void PickupService::Update(float deltaTime) {
     for (auto& pickup : m_Pickups) {
         pickup.remainingTime -= deltaTime;
@@ -40,7 +44,7 @@ void PickupService::Clear() {
 
 void PickupService::SpawnPointPickups(const Position& origin) {
     // Refactor: Random count logic kept here, but delegates to the main spawn function
-    int pickupCount = 5 + (std::rand() % 6);
+    int pickupCount = std::uniform_int_distribution<int>(5, 10)(*m_Random);
     SpawnPointPickups(origin, pickupCount, 1);
 }
 
@@ -86,42 +90,43 @@ bool PickupService::CollectPickup(int pickupId) {
 
 std::vector<PointPickup> PickupService::ProcessPickupCollection(float centerX, float centerY, float zoneSize) {
     std::vector<PointPickup> collected;
-    ProcessPickupCollection(centerX, centerY, zoneSize, collected);
+    Position center{ centerX, centerY };
+    ProcessPickupCollection(center, center, zoneSize, collected);
     return collected;
 }
 
-void PickupService::ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
+void PickupService::ProcessPickupCollection(const Position& from, const Position& to, float damageZoneSize,
     std::vector<PointPickup>& collectedPickups) {
     collectedPickups.clear();
 
-    float collectRectX = mouseX - damageZoneSize / 2.0f;
-    float collectRectY = mouseY - damageZoneSize / 2.0f;
-
-    std::vector<int> idsToRemove;
-
-    for (const PointPickup& pickup : m_Pickups) {
+    // Refactor: Collectable pickups go through one batched swept test instead of a rect check each
+    m_CollectionQuery.Clear();
+    m_CandidateIndices.clear();
+    for (size_t i = 0; i < m_Pickups.size(); ++i) {
+        const PointPickup& pickup = m_Pickups[i];
         if (pickup.GetAge() < GameConfig::PICKUP_COLLECT_DELAY) {
             continue;
         }
 
-        if (CheckCollision(pickup, collectRectX, collectRectY, damageZoneSize)) {
-            collectedPickups.push_back(pickup);
-            idsToRemove.push_back(pickup.id);
-        }
+        m_CollectionQuery.Add(pickup.position, pickup.size, 0.0f);
+        m_CandidateIndices.push_back(i);
     }
 
-    for (int id : idsToRemove) {
-        CollectPickup(id);
+    if (m_CandidateIndices.empty()) {
+        return;
     }
-}
 
-bool PickupService::CheckCollision(const PointPickup& pickup, float rectX, float rectY, float rectSize) const {
-    bool notIntersecting = (pickup.position.x + pickup.size < rectX) ||
-        (pickup.position.x - pickup.size > rectX + rectSize) ||
-        (pickup.position.y + pickup.size < rectY) ||
-        (pickup.position.y - pickup.size > rectY + rectSize);
+    m_CollectionQuery.Run(from, to, damageZoneSize);
 
-    return !notIntersecting;
+    for (size_t i = 0; i < m_CandidateIndices.size(); ++i) {
+        if (m_CollectionQuery.IsHit(i)) {
+            collectedPickups.push_back(m_Pickups[m_CandidateIndices[i]]);
+        }
+    }
+
+    for (const PointPickup& pickup : collectedPickups) {
+        CollectPickup(pickup.id);
+    }
 }
 
 const std::vector<PointPickup>& PickupService::GetPickups() const {
@@ -133,6 +138,5 @@ int PickupService::GetPickupPoints() const {
 }
 
 float PickupService::RandomRange(float minValue, float maxValue) const {
-    float t = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-    return minValue + (maxValue - minValue) * t;
+    return std::uniform_real_distribution<float>(minValue, maxValue)(*m_Random);
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <random>
 #include <vector>
 
+#include "Collision/SweptZoneQuery.h"
 #include "Services/IPickupService.h"
 #include "Types/PointPickup.h"
 #include "Types/Position.h"
@@ -19,6 +21,11 @@ class PickupService : public IPickupService {
     int m_NextPickupId;
     int m_PickupPoints;
     float m_ScreenHeight;
+    std::mt19937* m_Random; // Owned by the Game, so one seed drives the whole simulation
+
+    // Collection scratch, reused every update
+    SweptZoneQuery m_CollectionQuery;
+    std::vector<size_t> m_CandidateIndices; // Into m_Pickups, one per query target
 
 	//Refactor: No magic numbers, turned into constants
     static constexpr float TWO_PI = 6.28318530718f;
@@ -34,6 +41,11 @@ class PickupService : public IPickupService {
      * @brief Initializes the service with screen dimensions for scaling.
      */
     void Initialize(float screenHeight);
+
+    /**
+     * @brief Sets the random engine pickup counts and scatter are drawn from; must be set before spawning.
+     */
+    void SetRandomEngine(std::mt19937* random);
     void Update(float deltaTime) override;
     void Clear() override;
     void Reset();
@@ -46,7 +58,7 @@ class PickupService : public IPickupService {
      * @brief Deprecated/Legacy method. Consider using the void version instead.
      */
     std::vector<PointPickup> ProcessPickupCollection(float centerX, float centerY, float zoneSize);
-    void ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
+    void ProcessPickupCollection(const Position& from, const Position& to, float damageZoneSize,
                                  std::vector<PointPickup>& collectedPickups) override;
 
     const std::vector<PointPickup>& GetPickups() const override;
@@ -55,8 +67,4 @@ class PickupService : public IPickupService {
    private:
     float RandomRange(float minValue, float maxValue) const;
 
-    /**
-     * @brief Helper to check AABB (Axis-Aligned Bounding Box) collision.
-     */
-    bool CheckCollision(const PointPickup& pickup, float rectX, float rectY, float rectSize) const;
 };
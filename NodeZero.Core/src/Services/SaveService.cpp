@@ -14,7 +14,8 @@
 #include <unistd.h>
 #endif
 
-SaveService::SaveService() {
+SaveService::SaveService()
+    : m_DataDirectory(ResolveDataDirectory()) {
     m_CurrentData = ReadFromFile();
 }
 
@@ -23,7 +24,7 @@ void SaveService::Initialize() {
 }
 
 SaveData SaveService::LoadProgress() {
-    m_CurrentData = ReadFromFile();
+    // Refactor: The file is read once at construction; SaveProgress keeps m_CurrentData equal to it
     return m_CurrentData;
 }
 
@@ -46,7 +47,11 @@ SaveData SaveService::GetCurrentData() const {
 
 // Private Helper Methods (Refactored from static functions)
 
-std::string SaveService::GetSavePath() const {
+std::string SaveService::GetDataDirectory() const {
+    return m_DataDirectory;
+}
+
+std::string SaveService::ResolveDataDirectory() {
     std::string savePath;
 
 #ifdef _WIN32
@@ -82,7 +87,11 @@ std::string SaveService::GetSavePath() const {
     }
 #endif
 
-    return savePath + SAVE_FILE_NAME;
+    return savePath;
+}
+
+std::string SaveService::GetSavePath() const {
+    return GetDataDirectory() + SAVE_FILE_NAME;
 }
 
 bool SaveService::WriteToFile(const SaveData& data) const {
@@ -14,7 +14,8 @@
  */
 class SaveService : public ISaveService {
 private:
-    SaveData m_CurrentData;
+    SaveData m_CurrentData;     // Mirrors the save file: read once, updated on every save
+    std::string m_DataDirectory; // Resolved (and created) once
 
 	//Refactor: No magic strings, turned into constants
     static constexpr const char* SAVE_FILE_NAME = "save.dat";
@@ -33,7 +34,7 @@ public:
     ~SaveService() override = default;
 
     /**
-     * @brief Initializes the service by attempting to load existing data.
+     * @brief Re-reads the save file, replacing the data read at construction.
      */
     void Initialize();
 
@@ -44,10 +45,17 @@ public:
     int GetHighPoints() const override;
     SaveData GetCurrentData() const override;
 
+    std::string GetDataDirectory() const override;
+
 private:
     /**
-     * @brief Determines the correct file path for saving data based on the OS.
-     * @return The full absolute path to the save file.
+     * @brief Determines the per-user data directory based on the OS
+     * (AppData on Windows, ~/.local/share on Linux), creating it if needed.
+     */
+    static std::string ResolveDataDirectory();
+
+    /**
+     * @brief Full path of the save file inside the data directory.
      */
     std::string GetSavePath() const;
 
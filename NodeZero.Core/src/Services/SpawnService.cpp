@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
 
 #include "Config/GameConfig.h"
 
@@ -10,7 +9,8 @@ SpawnService::SpawnService()
     : m_ScreenWidth(0.0f),
     m_ScreenHeight(0.0f),
     m_SpawnTimer(0.0f),
-    m_CurrentLevel(1) {
+    m_CurrentLevel(1),
+    m_Random(nullptr) {
 }
 
 void SpawnService::Initialize(float screenWidth, float screenHeight) {
@@ -30,11 +30,15 @@ void SpawnService::SetCurrentLevel(int level) {
     m_CurrentLevel = level;
 }
 
+void SpawnService::SetRandomEngine(std::mt19937* random) {
+    m_Random = random;
+}
+
 SpawnInfo SpawnService::GetNextSpawn() const {
     const float centerX = m_ScreenWidth / 2.0f;
     const float centerY = m_ScreenHeight / 2.0f;
 
-    int edge = std::rand() % 4;
+    int edge = std::uniform_int_distribution<int>(0, 3)(*m_Random);
     float spawnX = 0.0f;
     float spawnY = 0.0f;
 
@@ -83,7 +87,7 @@ SpawnInfo SpawnService::GetNextSpawn() const {
 }
 
 NodeShape SpawnService::GetRandomShape() const {
-    int chance = std::rand() % 100;
+    int chance = std::uniform_int_distribution<int>(0, 99)(*m_Random);
 
     // Refactor: Use named probability constants
     if (chance < CHANCE_SQUARE) {
@@ -102,8 +106,7 @@ float SpawnService::CalculateNodeHP(float baseHP) const {
 }
 
 float SpawnService::RandomRange(float minValue, float maxValue) const {
-    float t = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-    return minValue + (maxValue - minValue) * t;
+    return std::uniform_real_distribution<float>(minValue, maxValue)(*m_Random);
 }
 
 bool SpawnService::ShouldAutoSpawn() const {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <random>
+
 #include "Enums/NodeShape.h"
 #include "Services/ISpawnService.h"
 
@@ -16,6 +18,7 @@ class SpawnService : public ISpawnService {
     float m_ScreenHeight;
     float m_SpawnTimer;
     int m_CurrentLevel;
+    std::mt19937* m_Random; // Owned by the Game, so one seed drives the whole simulation
 
     //Refactor: Game balance tweaks
 
@@ -51,6 +54,11 @@ class SpawnService : public ISpawnService {
 
     void SetCurrentLevel(int level);
 
+    /**
+     * @brief Sets the random engine spawns are drawn from; must be set before GetNextSpawn().
+     */
+    void SetRandomEngine(std::mt19937* random);
+
     SpawnInfo GetNextSpawn() const override;
     float CalculateNodeHP(float baseHP) const override;
     bool ShouldAutoSpawn() const override;
@@ -0,0 +1,225 @@
+#include "Simulation/SimulationThread.h"
+
+#include <algorithm>
+
+#include "Events/IObserver.h"
+#include "IGame.h"
+#include "Services/IHealthService.h"
+#include "Services/ILevelService.h"
+#include "Services/IPickupService.h"
+#include "Services/IUpgradeService.h"
+
+/**
+ * @class EventCollector
+ * @brief Copies every GameEvent the Game notifies into the simulation's pending list.
+ * Runs on whichever thread currently owns the Game.
+ */
+class EventCollector : public IObserver {
+public:
+    explicit EventCollector(std::vector<GameEvent>& events) : m_Events(events) {}
+
+    void Update(const IEvent& event) override {
+        m_Events.push_back(static_cast<const GameEvent&>(event));
+    }
+
+private:
+    std::vector<GameEvent>& m_Events;
+};
+
+SimulationThread::SimulationThread(IGame& game, float tickRate)
+    : m_Game(game),
+    m_TickPeriod(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / tickRate))),
+    m_TickDelta(1.0f / tickRate) {
+    m_Collector = std::make_shared<EventCollector>(m_PendingEvents);
+    m_Game.Attach(m_Collector);
+}
+
+SimulationThread::~SimulationThread() {
+    Stop();
+    m_Game.Detach(m_Collector);
+}
+
+void SimulationThread::Start() {
+    if (m_Thread.joinable()) {
+        return;
+    }
+
+    m_Stopping = false;
+    m_Thread = std::thread(&SimulationThread::Run, this);
+}
+
+void SimulationThread::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+        m_Ticking = false;
+    }
+    m_Condition.notify_all();
+
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+
+void SimulationThread::Resume() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Ticking) return;
+    }
+
+    // The thread is idle, so the Game still belongs to the caller here. The cursor moved
+    // freely while paused; the first tick must not sweep the zone along that path.
+    m_Game.ResetMouseTrail();
+    PublishSnapshot();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Ticking = true;
+    }
+    m_Condition.notify_all();
+}
+
+void SimulationThread::Pause() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Ticking = false;
+    m_Condition.notify_all();
+
+    // A tick in progress finishes first; the mutex hand-off makes its writes visible here
+    m_Condition.wait(lock, [this] { return !m_InTick; });
+}
+
+bool SimulationThread::IsTicking() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Ticking;
+}
+
+void SimulationThread::Step() {
+    Tick();
+}
+
+void SimulationThread::SetMousePosition(float x, float y) {
+    m_Mouse.store(Position{ x, y }, std::memory_order_relaxed);
+}
+
+void SimulationThread::Run() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    auto nextTick = std::chrono::steady_clock::now();
+    bool wasTicking = false;
+
+    while (!m_Stopping) {
+        if (!m_Ticking) {
+            wasTicking = false;
+            m_Condition.wait(lock, [this] { return m_Ticking || m_Stopping; });
+            continue;
+        }
+
+        // Time spent paused is not simulated: the clock restarts on resume
+        if (!wasTicking) {
+            nextTick = std::chrono::steady_clock::now();
+            wasTicking = true;
+        }
+
+        // Sleep until the tick is due; Pause() and Stop() wake it early
+        if (m_Condition.wait_until(lock, nextTick, [this] { return !m_Ticking || m_Stopping; })) {
+            continue;
+        }
+
+        m_InTick = true;
+        lock.unlock();
+        bool finished = Tick();
+        lock.lock();
+        m_InTick = false;
+        m_Condition.notify_all();
+
+        // Game over or level done: nothing more to simulate until the app resumes it
+        if (finished) {
+            m_Ticking = false;
+            continue;
+        }
+
+        nextTick += m_TickPeriod;
+
+        // After a long stall, skip the missed ticks instead of running them back to back
+        auto now = std::chrono::steady_clock::now();
+        if (now - nextTick > m_TickPeriod * MAX_CATCH_UP_TICKS) {
+            nextTick = now;
+        }
+    }
+}
+
+bool SimulationThread::Tick() {
+    // Only the newest cursor position matters; older ones were never simulated
+    Position mouse = m_Mouse.load(std::memory_order_relaxed);
+    m_Game.SetMousePosition(mouse.x, mouse.y);
+    m_Game.Update(m_TickDelta);
+    ++m_Tick;
+
+    PublishSnapshot();
+    return m_Game.GetHealthService().IsZero() || m_Game.GetLevelService().IsLevelCompleted();
+}
+
+void SimulationThread::PublishSnapshot() {
+    // Forget the events the render thread has already taken
+    uint64_t delivered = m_DeliveredEvents.load(std::memory_order_acquire);
+    if (delivered > m_PendingFirstSequence) {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(delivered - m_PendingFirstSequence, m_PendingEvents.size()));
+        m_PendingEvents.erase(m_PendingEvents.begin(), m_PendingEvents.begin() + count);
+        m_PendingFirstSequence += count;
+    }
+    // A stalled consumer loses the oldest events rather than growing the list without bound;
+    // dropping only from the front keeps the sequence numbers the consumer relies on
+    if (m_PendingEvents.size() > MAX_PENDING_EVENTS) {
+        size_t count = m_PendingEvents.size() - MAX_PENDING_EVENTS;
+        m_PendingEvents.erase(m_PendingEvents.begin(), m_PendingEvents.begin() + count);
+        m_PendingFirstSequence += count;
+        m_DroppedEvents += count;
+    }
+
+    GameSnapshot& snapshot = m_Snapshots.GetWriteBuffer();
+    snapshot.tick = m_Tick;
+    snapshot.mouse = m_Mouse.load(std::memory_order_relaxed);
+
+    // Flat copies of the game's render arrays; buffers are reused, so after the first few ticks these do not allocate
+    RenderView view = m_Game.GetRenderView();
+    snapshot.nodes.assign(view.nodes.begin(), view.nodes.end());
+    snapshot.pickups.assign(view.pickups.begin(), view.pickups.end());
+
+    HudSnapshot& hud = snapshot.hud;
+    hud.health = m_Game.GetHealthService().GetCurrent();
+    hud.maxHealth = m_Game.GetUpgradeService().GetMaxHealth();
+    hud.points = m_Game.GetPickupService().GetPickupPoints();
+    hud.level = m_Game.GetLevelService().GetCurrentLevel();
+    hud.levelProgress = m_Game.GetLevelService().GetProgressBarPercentage();
+    hud.damageZoneSize = m_Game.GetUpgradeService().GetDamageZoneSize();
+    hud.liveNodes = m_Game.GetLiveNodeCount();
+    hud.peakNodes = m_Game.GetPeakNodeCount();
+
+    snapshot.healthDepleted = m_Game.GetHealthService().IsZero();
+    snapshot.levelCompleted = m_Game.GetLevelService().IsLevelCompleted();
+
+    snapshot.events.assign(m_PendingEvents.begin(), m_PendingEvents.end());
+    snapshot.firstEventSequence = m_PendingFirstSequence;
+    snapshot.droppedEvents = m_DroppedEvents;
+
+    m_Snapshots.Publish();
+}
+
+bool SimulationThread::AcquireSnapshot() {
+    bool acquired = m_Snapshots.Acquire();
+    GameSnapshot& snapshot = m_Snapshots.GetReadBuffer();
+
+    // Snapshots carry every undelivered event, so drop the ones an earlier acquire handed out
+    if (m_ConsumedEvents > snapshot.firstEventSequence) {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(m_ConsumedEvents - snapshot.firstEventSequence, snapshot.events.size()));
+        snapshot.events.erase(snapshot.events.begin(), snapshot.events.begin() + count);
+        snapshot.firstEventSequence += count;
+    }
+    m_ConsumedEvents = snapshot.firstEventSequence + snapshot.events.size();
+    m_DeliveredEvents.store(m_ConsumedEvents, std::memory_order_release);
+
+    return acquired;
+}
+
+const GameSnapshot& SimulationThread::GetSnapshot() const {
+    return m_Snapshots.GetReadBuffer();
+}
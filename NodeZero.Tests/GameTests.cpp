@@ -6,6 +6,8 @@
 #include "../NodeZero.Core/include/INode.h"
 #include "../NodeZero.Core/include/Events/IObserver.h"
 #include "../NodeZero.Core/include/Events/IEvent.h"
+#include "../NodeZero.Core/include/Services/IPickupService.h"
+#include "../NodeZero.Core/include/Types/RenderView.h"
 #include "../NodeZero.Core/include/Types/SpawnInfo.h"
 
 // Constants
@@ -13,13 +15,15 @@ static constexpr float TEST_WIDTH = 800.0f;
 static constexpr float TEST_HEIGHT = 600.0f;
 static constexpr float TEST_DELTA_TIME = 0.016f;
 static constexpr int STRESS_TEST_COUNT = 50;
+static constexpr int LONG_RUN_FRAMES = 12000; // 20 minutes at 0.1s steps
+static constexpr int LONG_RUN_NODE_LIMIT = 100;
 
-static SpawnInfo CreateTestSpawnInfo(float x, float y) {
+static SpawnInfo CreateTestSpawnInfo(float x, float y, float directionX = 0.0f, float directionY = 0.0f) {
     SpawnInfo info;
     info.position = Position{ x, y };
     info.shape = NodeShape::Circle;
-    info.directionX = 0.0f;
-    info.directionY = 0.0f;
+    info.directionX = directionX;
+    info.directionY = directionY;
     return info;
 }
 
@@ -31,7 +35,7 @@ class MockObserver : public IObserver {
 private:
     int m_EventCount = 0;
 public:
-    void Update(const std::shared_ptr<IEvent>& event) override {
+    void Update(const IEvent& event) override {
         m_EventCount++;
     }
     int GetEventCount() const { return m_EventCount; }
@@ -87,6 +91,40 @@ TEST_F(GameTest, ResetClearsNodes) {
     EXPECT_EQ(game->GetNodesDestroyed(), 0);
 }
 
+/** @brief Verifies the render view mirrors the active nodes as plain data. */
+TEST_F(GameTest, RenderViewMatchesNodes) {
+    game->SpawnNode(CreateTestSpawnInfo(100.0f, 100.0f));
+    game->SpawnNode(CreateTestSpawnInfo(200.0f, 150.0f));
+
+    RenderView view = game->GetRenderView();
+    ASSERT_EQ(view.nodes.size, game->GetNodes().size());
+    for (size_t i = 0; i < view.nodes.size; ++i) {
+        const INode* node = game->GetNodes()[i];
+        EXPECT_FLOAT_EQ(view.nodes[i].position.x, node->GetPosition().x);
+        EXPECT_FLOAT_EQ(view.nodes[i].size, node->GetSize());
+        EXPECT_FLOAT_EQ(view.nodes[i].hpRatio, node->GetHP() / node->GetMaxHP());
+        EXPECT_EQ(view.nodes[i].shape, node->GetShape());
+    }
+
+    game->Reset();
+    EXPECT_TRUE(game->GetRenderView().nodes.empty());
+}
+
+/** @brief Verifies pickups collected by an update show up in the render view. */
+TEST_F(GameTest, RenderViewListsCollectedPickups) {
+    Position origin{ TEST_WIDTH / 2.0f, TEST_HEIGHT / 2.0f };
+    game->GetPickupService().SpawnPointPickups(origin, 3, 1);
+    game->SetMousePosition(origin.x, origin.y);
+
+    // First update ages the pickups past the collect delay, the second collects them
+    game->Update(0.2f);
+    game->Update(0.2f);
+
+    RenderView view = game->GetRenderView();
+    EXPECT_FALSE(view.collectedPickups.empty());
+    EXPECT_EQ(view.pickups.size, game->GetPickupService().GetPickups().size());
+}
+
 /** @brief Verifies that the Observer pattern is wired up correctly. */
 TEST_F(GameTest, ObserverPatternWorks) {
     auto observer = std::make_shared<MockObserver>();
@@ -110,4 +148,37 @@ TEST_F(GameTest, ManyNodesDoNotCrash) {
     }
 
     EXPECT_NO_THROW(game->Update(TEST_DELTA_TIME));
-}
\ No newline at end of file
+}
+
+/** @brief Verifies that nodes leaving through any edge are despawned, not only the left one. */
+TEST_F(GameTest, NodesLeavingAnyEdgeAreDespawned) {
+    // Move the damage zone away so no node is destroyed on the way out
+    game->SetMousePosition(-1000.0f, -1000.0f);
+
+    game->SpawnNode(CreateTestSpawnInfo(TEST_WIDTH / 2.0f, TEST_HEIGHT / 2.0f, 0.0f, -1.0f));
+    game->SpawnNode(CreateTestSpawnInfo(TEST_WIDTH / 2.0f, TEST_HEIGHT / 2.0f, 1.0f, 0.0f));
+    game->SpawnNode(CreateTestSpawnInfo(TEST_WIDTH / 2.0f, TEST_HEIGHT / 2.0f, 0.0f, 1.0f));
+    game->SpawnNode(CreateTestSpawnInfo(TEST_WIDTH / 2.0f, TEST_HEIGHT / 2.0f, -1.0f, 0.0f));
+    EXPECT_EQ(game->GetPeakNodeCount(), 4);
+
+    // 20 seconds at default speed covers far more than half the screen plus the margin
+    for (int i = 0; i < 200; ++i) {
+        game->Update(0.1f);
+    }
+
+    EXPECT_GE(game->GetNodesDespawned(), 4);
+    EXPECT_EQ(game->GetNodesDestroyed(), 0);
+}
+
+/** @brief Long session: the live entity count must stay bounded instead of growing forever. */
+TEST_F(GameTest, LiveNodeCountStaysBoundedOverLongRun) {
+    game->SetMousePosition(-1000.0f, -1000.0f);
+
+    for (int i = 0; i < LONG_RUN_FRAMES; ++i) {
+        game->Update(0.1f);
+        ASSERT_LE(game->GetLiveNodeCount(), LONG_RUN_NODE_LIMIT);
+    }
+
+    EXPECT_GT(game->GetNodesDespawned(), 0);
+    EXPECT_LE(game->GetPeakNodeCount(), LONG_RUN_NODE_LIMIT);
+}
@@ -1,6 +1,5 @@
 #include <gtest/gtest.h>
-#include <cstdlib>
-#include <ctime>
+#include <random>
 
 #include "../NodeZero.Core/src/Services/LevelService.h"
 #include "../NodeZero.Core/src/Services/SpawnService.h"
@@ -50,10 +49,11 @@ TEST_F(LevelServiceTest, BossSpawningLogic) {
 class SpawnServiceTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        std::srand(42); // Deterministic seed for testing
         spawnService = std::make_unique<SpawnService>();
         spawnService->Initialize(800.0f, 600.0f);
+        spawnService->SetRandomEngine(&random);
     }
+    std::mt19937 random{ 42 }; // Deterministic seed for testing
     std::unique_ptr<SpawnService> spawnService;
 };
 
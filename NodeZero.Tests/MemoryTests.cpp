@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <new>
+
+#include "../NodeZero.Core/src/Game.h"
+#include "../NodeZero.Core/include/Events/GameEvents.h"
+#include "../NodeZero.Core/include/Events/IObserver.h"
+#include "../NodeZero.Core/include/INode.h"
+#include "../NodeZero.Core/include/Memory/ArenaAllocator.h"
+#include "../NodeZero.Core/include/Memory/FrameArena.h"
+#include "../NodeZero.Core/include/Types/SpawnInfo.h"
+
+// Constants
+static constexpr float MEM_TEST_WIDTH = 800.0f;
+static constexpr float MEM_TEST_HEIGHT = 600.0f;
+static constexpr float MEM_TEST_DELTA_TIME = 1.0f / 60.0f;
+static constexpr size_t SMALL_BLOCK_SIZE = 256;
+static constexpr int RUN_TICKS = 3600; // One minute at 60 Hz
+static constexpr unsigned int RUN_SEED = 12345;
+static constexpr int CENTER_NODE_COUNT = 5;
+static constexpr float CENTER_NODE_HP = 1.0e9f; // Survives every hit of the test
+
+// -----------------------------------------------------------------------------
+// Global allocation counter
+// -----------------------------------------------------------------------------
+
+// Replaces the global allocation functions for the whole test binary; counting is off
+// except inside a measured section, so other tests only pay for one relaxed load.
+// Every form (plain, array, sized, aligned) goes through the same malloc/free pair,
+// so whichever delete the compiler pairs with a new, the memory is released correctly.
+static std::atomic<bool> g_CountAllocations{ false };
+static std::atomic<int> g_AllocationCount{ 0 };
+
+static void* CountedAllocate(size_t size) {
+    if (g_CountAllocations.load(std::memory_order_relaxed)) {
+        g_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+static void CountedFree(void* memory) noexcept {
+    std::free(memory);
+}
+
+// Over-allocates and keeps the malloc'd pointer just below the aligned block
+static void* CountedAllocateAligned(size_t size, std::align_val_t alignment) {
+    const size_t align = static_cast<size_t>(alignment);
+    void* raw = CountedAllocate(size + align + sizeof(void*));
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+}
+
+static void CountedFreeAligned(void* memory) noexcept {
+    if (memory) {
+        CountedFree(static_cast<void**>(memory)[-1]);
+    }
+}
+
+void* operator new(size_t size) { return CountedAllocate(size); }
+void* operator new[](size_t size) { return CountedAllocate(size); }
+void operator delete(void* memory) noexcept { CountedFree(memory); }
+void operator delete[](void* memory) noexcept { CountedFree(memory); }
+void operator delete(void* memory, size_t) noexcept { CountedFree(memory); }
+void operator delete[](void* memory, size_t) noexcept { CountedFree(memory); }
+
+void* operator new(size_t size, std::align_val_t alignment) { return CountedAllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return CountedAllocateAligned(size, alignment); }
+void operator delete(void* memory, std::align_val_t) noexcept { CountedFreeAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { CountedFreeAligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { CountedFreeAligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { CountedFreeAligned(memory); }
+
+// -----------------------------------------------------------------------------
+// FrameArena
+// -----------------------------------------------------------------------------
+
+/** @brief Allocations are distinct and honour the requested alignment. */
+TEST(FrameArenaTest, AllocationsAreAlignedAndDistinct) {
+    FrameArena arena(SMALL_BLOCK_SIZE);
+
+    void* a = arena.Allocate(3, 1);
+    void* b = arena.Allocate(8, 8);
+    void* c = arena.Allocate(16, 16);
+
+    EXPECT_NE(a, b);
+    EXPECT_NE(b, c);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % 16, 0u);
+    EXPECT_GE(arena.GetUsed(), 3u + 8u + 16u);
+}
+
+/** @brief After a reset the same memory is handed out again. */
+TEST(FrameArenaTest, ResetReusesMemory) {
+    FrameArena arena(SMALL_BLOCK_SIZE);
+
+    void* first = arena.Allocate(64, 8);
+    arena.Reset();
+
+    EXPECT_EQ(arena.GetUsed(), 0u);
+    EXPECT_EQ(arena.Allocate(64, 8), first);
+}
+
+/** @brief Requests past the block size add blocks, which the arena keeps over a reset. */
+TEST(FrameArenaTest, GrowsAndKeepsCapacityAfterReset) {
+    FrameArena arena(SMALL_BLOCK_SIZE);
+
+    arena.Allocate(SMALL_BLOCK_SIZE / 2, 8);
+    arena.Allocate(SMALL_BLOCK_SIZE, 8);
+    arena.Allocate(SMALL_BLOCK_SIZE * 4, 8);
+    size_t capacity = arena.GetCapacity();
+    EXPECT_GE(capacity, SMALL_BLOCK_SIZE * 6);
+
+    arena.Reset();
+    g_AllocationCount = 0;
+    g_CountAllocations = true;
+    arena.Allocate(SMALL_BLOCK_SIZE / 2, 8);
+    arena.Allocate(SMALL_BLOCK_SIZE, 8);
+    arena.Allocate(SMALL_BLOCK_SIZE * 4, 8);
+    g_CountAllocations = false;
+
+    EXPECT_EQ(g_AllocationCount.load(), 0);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+/** @brief Standard containers run on the arena allocator. */
+TEST(FrameArenaTest, ContainersUseArenaMemory) {
+    FrameArena arena(SMALL_BLOCK_SIZE);
+
+    ArenaVector<int> values{ ArenaAllocator<int>(arena) };
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    std::list<int, ArenaAllocator<int>> items{ ArenaAllocator<int>(arena) };
+    items.push_back(1);
+    items.push_back(2);
+
+    EXPECT_EQ(values.size(), 100u);
+    EXPECT_EQ(values[99], 99);
+    EXPECT_EQ(items.back(), 2);
+    EXPECT_GE(arena.GetUsed(), 100 * sizeof(int));
+}
+
+// -----------------------------------------------------------------------------
+// Game
+// -----------------------------------------------------------------------------
+
+/**
+ * @class TickEventCounter
+ * @brief Counts the events of interest to the allocation test, without allocating.
+ */
+class TickEventCounter : public IObserver {
+public:
+    void Update(const IEvent& event) override {
+        EventType type = static_cast<const GameEvent&>(event).type;
+        if (type == EventType::NodeDamaged) {
+            ++m_Damaged;
+        }
+        else if (type != EventType::PickupCollected) {
+            ++m_Other;
+        }
+    }
+    int GetDamaged() const { return m_Damaged; }
+    int GetOther() const { return m_Other; }
+
+private:
+    int m_Damaged = 0;
+    int m_Other = 0; // Spawns, kills, level changes
+};
+
+/**
+ * @brief A replayed run allocates nothing outside the ticks that spawn or destroy nodes.
+ * The first run grows the game's buffers and the frame arena to what the run needs; Reset()
+ * keeps them, so the same run again (same seed, same cursor path) must reuse them. Creating
+ * a node and dropping pickups still reach the heap, so those ticks are skipped; the damage
+ * sweep, pickup collection and their events must not.
+ */
+TEST(FrameArenaGameTest, ReplayedTicksDoNotAllocate) {
+    Game game;
+    game.Initialize(MEM_TEST_WIDTH, MEM_TEST_HEIGHT);
+    auto counter = std::make_shared<TickEventCounter>();
+    game.Attach(counter);
+
+    int measured = 0;
+    int measuredDamage = 0;
+    int allocations = 0;
+    for (int run = 0; run < 2; ++run) {
+        const bool measuring = run == 1;
+        game.SeedRandom(RUN_SEED);
+        game.Reset();
+
+        for (int i = 0; i < CENTER_NODE_COUNT; ++i) {
+            SpawnInfo info;
+            info.position = Position{ MEM_TEST_WIDTH / 2.0f, MEM_TEST_HEIGHT / 2.0f };
+            info.shape = NodeShape::Square;
+            game.SpawnNode(info);
+            game.GetNodes().back()->SetHP(CENTER_NODE_HP);
+        }
+
+        for (int frame = 0; frame < RUN_TICKS; ++frame) {
+            int damagedBefore = counter->GetDamaged();
+            int otherBefore = counter->GetOther();
+
+            // The cursor sweeps back and forth across the middle of the screen
+            float phase = static_cast<float>(frame) * MEM_TEST_DELTA_TIME;
+            game.SetMousePosition(MEM_TEST_WIDTH / 2.0f + std::sin(phase) * MEM_TEST_WIDTH * 0.4f, MEM_TEST_HEIGHT / 2.0f);
+
+            g_AllocationCount = 0;
+            g_CountAllocations = measuring;
+            game.Update(MEM_TEST_DELTA_TIME);
+            g_CountAllocations = false;
+
+            if (!measuring || counter->GetOther() != otherBefore) continue;
+
+            ++measured;
+            measuredDamage += counter->GetDamaged() - damagedBefore;
+            allocations += g_AllocationCount.load();
+        }
+    }
+
+    game.Detach(counter);
+    EXPECT_GT(measured, RUN_TICKS / 2);
+    EXPECT_GT(measuredDamage, 0);
+    EXPECT_EQ(allocations, 0);
+}
@@ -1,6 +1,5 @@
 #include <gtest/gtest.h>
-#include <cstdlib>
-#include <ctime>
+#include <random>
 
 #include "../NodeZero.Core/src/Services/PickupService.h"
 #include "../NodeZero.Core/src/Services/DamageZoneService.h"
@@ -15,6 +14,8 @@
 static constexpr float TEST_SCREEN_HEIGHT = 600.0f;
 static constexpr float ZONE_X = 400.0f;
 static constexpr float ZONE_Y = 300.0f;
+static constexpr float SWEEP_START_X = 0.0f;
+static constexpr float SWEEP_END_X = 800.0f;
 
 /**
  * @class PickupServiceTest
@@ -23,10 +24,11 @@ static constexpr float ZONE_Y = 300.0f;
 class PickupServiceTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        std::srand(42);
         pickupService = std::make_unique<PickupService>();
         pickupService->Initialize(TEST_SCREEN_HEIGHT);
+        pickupService->SetRandomEngine(&random);
     }
+    std::mt19937 random{ 42 };
     std::unique_ptr<PickupService> pickupService;
 };
 
@@ -64,6 +66,27 @@ TEST_F(PickupServiceTest, CollectPickupFailsBeforeDelay) {
     EXPECT_FALSE(collected);
 }
 
+/** @brief A fast cursor move collects the pickups between two updates, not only those at either end. */
+TEST_F(PickupServiceTest, SweptCollectionCollectsAlongThePath) {
+    pickupService->SpawnPointPickups(Position{ ZONE_X, ZONE_Y }, 5, 1);
+    pickupService->Update(GameConfig::PICKUP_COLLECT_DELAY + 0.01f);
+
+    std::vector<PointPickup> collected;
+    Position start{ SWEEP_START_X, ZONE_Y };
+    Position end{ SWEEP_END_X, ZONE_Y };
+
+    // Neither end position reaches the pickups on its own
+    pickupService->ProcessPickupCollection(start, start, 100.0f, collected);
+    EXPECT_TRUE(collected.empty());
+    pickupService->ProcessPickupCollection(end, end, 100.0f, collected);
+    EXPECT_TRUE(collected.empty());
+
+    pickupService->ProcessPickupCollection(start, end, 100.0f, collected);
+    EXPECT_EQ(collected.size(), 5u);
+    EXPECT_TRUE(pickupService->GetPickups().empty());
+    EXPECT_EQ(pickupService->GetPickupPoints(), 5);
+}
+
 /**
  * @class DamageZoneServiceTest
  * @brief Tests for the player's primary attack mechanic.
@@ -91,4 +114,41 @@ TEST_F(DamageZoneServiceTest, NodeInZoneTakesDamage) {
 
     EXPECT_LT(node->GetHP(), 100.0f);
     EXPECT_GT(capturedCost, 0.0f); // Should return a health cost
-}
\ No newline at end of file
+}
+
+/** @brief A zone swept across a node damages it even though both end positions miss it. */
+TEST_F(DamageZoneServiceTest, SweptZoneDamagesNodeBetweenPositions) {
+    auto node = std::make_unique<Node>(NodeShape::Circle, 30.0f, 0.0f);
+    node->SetHP(100.0f);
+    node->Spawn(ZONE_X, ZONE_Y);
+    std::vector<Node*> nodes = { node.get() };
+
+    // A parallel sweep far above the node misses it
+    damageZoneService->ProcessDamageZone(Position{ SWEEP_START_X, 0.0f }, Position{ SWEEP_END_X, 0.0f },
+        20.0f, 50.0f, 1, nodes, nullptr);
+    EXPECT_FLOAT_EQ(node->GetHP(), 100.0f);
+
+    damageZoneService->ProcessDamageZone(Position{ SWEEP_START_X, ZONE_Y }, Position{ SWEEP_END_X, ZONE_Y },
+        20.0f, 50.0f, 1, nodes, nullptr);
+    EXPECT_LT(node->GetHP(), 100.0f);
+}
+
+/** @brief Nodes are circles: one just off the zone's corner is missed, though its bounding box overlaps. */
+TEST_F(DamageZoneServiceTest, NodeOffZoneCornerIsMissed) {
+    const float zoneSize = 100.0f;
+    const float nodeSize = 10.0f;
+    const float cornerOffset = zoneSize / 2.0f + 8.0f; // 8 * sqrt(2) > 10 from the corner, 8 < 10 per axis
+
+    auto node = std::make_unique<Node>(NodeShape::Circle, nodeSize, 0.0f);
+    node->SetHP(100.0f);
+    node->Spawn(ZONE_X + cornerOffset, ZONE_Y + cornerOffset);
+    std::vector<Node*> nodes = { node.get() };
+
+    damageZoneService->ProcessDamageZone(ZONE_X, ZONE_Y, zoneSize, 50.0f, 1, nodes, nullptr);
+    EXPECT_FLOAT_EQ(node->GetHP(), 100.0f);
+
+    // Sweeping the zone a little toward the node along the diagonal brings the corner within reach
+    damageZoneService->ProcessDamageZone(Position{ ZONE_X, ZONE_Y }, Position{ ZONE_X + 4.0f, ZONE_Y + 4.0f },
+        zoneSize, 50.0f, 1, nodes, nullptr);
+    EXPECT_LT(node->GetHP(), 100.0f);
+}
@@ -4,6 +4,9 @@
  */
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 #include "../NodeZero.Core/src/Services/HealthService.h"
 #include "../NodeZero.Core/src/Services/UpgradeService.h"
 #include "../NodeZero.Core/src/Services/SaveService.h"
@@ -70,6 +73,7 @@ public:
     int GetPoints() const override { return m_Data.points; }
     int GetHighPoints() const override { return m_Data.highPoints; }
     SaveData GetCurrentData() const override { return m_Data; }
+    std::string GetDataDirectory() const override { return "./"; }
 };
 
 /**
@@ -110,4 +114,22 @@ TEST_F(UpgradeServiceTest, UpgradesFailWithInsufficientPoints) {
 
     EXPECT_FALSE(upgradeService->BuyHealthUpgrade());
     EXPECT_FALSE(upgradeService->BuyRegenUpgrade());
-}
\ No newline at end of file
+}
+
+/** @brief Verifies the data directory is a usable folder that holds the save file. */
+TEST(SaveServiceTest, DataDirectoryExistsAndHoldsSaveFile) {
+    SaveService saveService;
+    std::string directory = saveService.GetDataDirectory();
+
+    ASSERT_FALSE(directory.empty());
+    char last = directory.back();
+    EXPECT_TRUE(last == '/' || last == '\\');
+
+    // The directory is created on demand, so a probe file can be written into it
+    std::string probePath = directory + "data_directory_probe.tmp";
+    {
+        std::ofstream probe(probePath);
+        EXPECT_TRUE(probe.is_open());
+    }
+    std::remove(probePath.c_str());
+}
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "../NodeZero.Core/src/Game.h"
+#include "../NodeZero.Core/include/Simulation/SimulationThread.h"
+#include "../NodeZero.Core/include/Simulation/TripleBuffer.h"
+#include "../NodeZero.Core/include/Types/SpawnInfo.h"
+
+// Constants
+static constexpr float SIM_TEST_WIDTH = 800.0f;
+static constexpr float SIM_TEST_HEIGHT = 600.0f;
+static constexpr float SIM_TEST_TICK_RATE = 240.0f;
+static constexpr int HANDOFF_COUNT = 200000;
+
+/** @brief Two fields written together; a torn read would break b == 2 * a. */
+struct PairValue {
+    int a = 0;
+    int b = 0;
+};
+
+// -----------------------------------------------------------------------------
+// TripleBuffer
+// -----------------------------------------------------------------------------
+
+/** @brief Nothing is acquired before the first publish. */
+TEST(TripleBufferTest, AcquireWithoutPublishReturnsFalse) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.Acquire());
+}
+
+/** @brief The consumer sees the newest value, and only once. */
+TEST(TripleBufferTest, LatestPublishWins) {
+    TripleBuffer<int> buffer;
+    for (int value = 1; value <= 3; ++value) {
+        buffer.GetWriteBuffer() = value;
+        buffer.Publish();
+    }
+
+    ASSERT_TRUE(buffer.Acquire());
+    EXPECT_EQ(buffer.GetReadBuffer(), 3);
+    EXPECT_FALSE(buffer.Acquire());
+    EXPECT_EQ(buffer.GetReadBuffer(), 3);
+}
+
+/** @brief Publish reports when it replaces a value the consumer never took. */
+TEST(TripleBufferTest, PublishReportsUnreadOverwrite) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.Publish());
+    EXPECT_TRUE(buffer.Publish());
+
+    buffer.Acquire();
+    EXPECT_FALSE(buffer.Publish());
+}
+
+/** @brief Under concurrent use, every read is a whole value and values never go backwards. */
+TEST(TripleBufferTest, ConcurrentHandOffNeverTearsOrReorders) {
+    TripleBuffer<PairValue> buffer;
+
+    std::thread producer([&buffer]() {
+        for (int i = 1; i <= HANDOFF_COUNT; ++i) {
+            PairValue& value = buffer.GetWriteBuffer();
+            value.a = i;
+            value.b = i * 2;
+            buffer.Publish();
+        }
+        });
+
+    int last = 0;
+    while (last < HANDOFF_COUNT) {
+        if (!buffer.Acquire()) continue;
+
+        const PairValue& value = buffer.GetReadBuffer();
+        ASSERT_EQ(value.b, value.a * 2);
+        ASSERT_GT(value.a, last);
+        last = value.a;
+    }
+
+    producer.join();
+    EXPECT_EQ(last, HANDOFF_COUNT);
+}
+
+// -----------------------------------------------------------------------------
+// SimulationThread
+// -----------------------------------------------------------------------------
+
+/**
+ * @class SimulationThreadTest
+ * @brief Snapshot publishing and event delivery between the simulation and a consumer.
+ */
+class SimulationThreadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        game = std::make_unique<Game>();
+        game->Initialize(SIM_TEST_WIDTH, SIM_TEST_HEIGHT);
+        game->Reset();
+        simulation = std::make_unique<SimulationThread>(*game, SIM_TEST_TICK_RATE);
+    }
+
+    void TearDown() override {
+        simulation.reset();
+    }
+
+    void SpawnCenterNode() {
+        SpawnInfo info;
+        info.position = Position{ SIM_TEST_WIDTH / 2.0f, SIM_TEST_HEIGHT / 2.0f };
+        info.shape = NodeShape::Square;
+        game->SpawnNode(info);
+    }
+
+    std::unique_ptr<Game> game;
+    std::unique_ptr<SimulationThread> simulation;
+};
+
+/** @brief A stepped tick publishes the nodes and HUD values the renderer needs. */
+TEST_F(SimulationThreadTest, StepPublishesSnapshot) {
+    SpawnCenterNode();
+    simulation->Step();
+
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    const GameSnapshot& snapshot = simulation->GetSnapshot();
+
+    EXPECT_EQ(snapshot.tick, 1u);
+    ASSERT_EQ(snapshot.nodes.size(), 1u);
+    EXPECT_EQ(snapshot.nodes[0].shape, NodeShape::Square);
+    EXPECT_FLOAT_EQ(snapshot.nodes[0].size, game->GetNodes()[0]->GetSize());
+    EXPECT_EQ(snapshot.hud.liveNodes, game->GetLiveNodeCount());
+    EXPECT_EQ(snapshot.hud.level, game->GetLevelService().GetCurrentLevel());
+    EXPECT_FALSE(snapshot.healthDepleted);
+}
+
+/** @brief The tick simulates with the latest mouse position from the slot. */
+TEST_F(SimulationThreadTest, TickUsesLatestMousePosition) {
+    simulation->SetMousePosition(10.0f, 20.0f);
+    simulation->SetMousePosition(30.0f, 40.0f);
+    simulation->Step();
+
+    simulation->AcquireSnapshot();
+    EXPECT_FLOAT_EQ(simulation->GetSnapshot().mouse.x, 30.0f);
+    EXPECT_FLOAT_EQ(simulation->GetSnapshot().mouse.y, 40.0f);
+}
+
+/** @brief Events of snapshots the consumer skipped still arrive, each exactly once. */
+TEST_F(SimulationThreadTest, EventsDeliveredOnceAcrossSkippedSnapshots) {
+    SpawnCenterNode();
+    simulation->Step();
+    SpawnCenterNode();
+    simulation->Step();
+
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    int spawned = 0;
+    for (const GameEvent& event : simulation->GetSnapshot().events) {
+        if (event.type == EventType::NodeSpawned) ++spawned;
+    }
+    EXPECT_EQ(spawned, 2);
+
+    // Nothing new: the same snapshot stays, without the events already delivered
+    EXPECT_FALSE(simulation->AcquireSnapshot());
+    EXPECT_TRUE(simulation->GetSnapshot().events.empty());
+
+    // The next tick does not repeat them either
+    simulation->Step();
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    for (const GameEvent& event : simulation->GetSnapshot().events) {
+        bool isTestSpawn = event.type == EventType::NodeSpawned && event.position.x == SIM_TEST_WIDTH / 2.0f;
+        EXPECT_FALSE(isTestSpawn);
+    }
+}
+
+/** @brief A consumer that stalls past the cap loses the oldest events, and is told how many. */
+TEST_F(SimulationThreadTest, EventsPastCapAreDroppedAndCounted) {
+    for (size_t i = 0; i < SimulationThread::MAX_PENDING_EVENTS + 10; ++i) {
+        SpawnCenterNode();
+    }
+    simulation->Step();
+
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    const GameSnapshot& snapshot = simulation->GetSnapshot();
+    EXPECT_EQ(snapshot.events.size(), SimulationThread::MAX_PENDING_EVENTS);
+    EXPECT_GE(snapshot.droppedEvents, 10u);
+    EXPECT_EQ(snapshot.firstEventSequence, snapshot.droppedEvents);
+    uint64_t dropped = snapshot.droppedEvents;
+
+    // Once delivered, the consumer is caught up; a quiet tick away from the nodes drops nothing more
+    simulation->SetMousePosition(0.0f, 0.0f);
+    simulation->Step();
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    EXPECT_LT(simulation->GetSnapshot().events.size(), SimulationThread::MAX_PENDING_EVENTS);
+    EXPECT_EQ(simulation->GetSnapshot().droppedEvents, dropped);
+}
+
+/** @brief Resume publishes the current state at once, before any tick. */
+TEST_F(SimulationThreadTest, ResumePublishesCurrentState) {
+    SpawnCenterNode();
+    simulation->Resume();
+    simulation->Pause();
+
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    EXPECT_GE(simulation->GetSnapshot().nodes.size(), 1u);
+}
+
+/** @brief The thread ticks between Resume and Pause, and leaves the game alone afterwards. */
+TEST_F(SimulationThreadTest, ThreadTicksOnlyWhileResumed) {
+    simulation->Start();
+    simulation->Resume();
+    EXPECT_TRUE(simulation->IsTicking());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    simulation->Pause();
+    EXPECT_FALSE(simulation->IsTicking());
+
+    ASSERT_TRUE(simulation->AcquireSnapshot());
+    uint64_t ticks = simulation->GetSnapshot().tick;
+    EXPECT_GT(ticks, 0u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(simulation->AcquireSnapshot());
+    EXPECT_EQ(simulation->GetSnapshot().tick, ticks);
+}
@@ -1,82 +1,58 @@
 #version 330
 
+// Effects are compiled in or out by CrtPass, which inserts these before the source:
+// CRT_CHROMATIC_ABERRATION, CRT_SCANLINES, CRT_NOISE, CRT_VIGNETTE
+
 in vec2 fragTexCoord;
 in vec4 fragColor;
 
 uniform sampler2D texture0;
 uniform vec4 colDiffuse;
 uniform vec2 resolution;
-uniform float time;
-
-out vec4 finalColor;
-
-// Barrel distortion (ecran curbat) - clasic cu colturi negre
-vec2 barrelDistortion(vec2 coord, float amount) {
-    vec2 cc = coord - 0.5;
-    float dist = dot(cc, cc);
-    return coord + cc * dist * amount;
-}
 
-// Chromatic aberration (separare RGB)
-vec3 chromaticAberration(sampler2D tex, vec2 uv, float amount) {
-    vec2 direction = uv - 0.5;
+uniform sampler2D maskLut;   // .r = scanline factor per screen row, .a = vignette (baked once)
+uniform sampler2D blueNoise; // Tiled blue noise, shifted every frame
+uniform vec2 noiseOffset;
+uniform float flicker;       // Per-frame brightness wobble (TV vechi)
 
-    vec2 uvR = uv + direction * amount * 0.003;
-    vec2 uvG = uv;
-    vec2 uvB = uv - direction * amount * 0.003;
-
-    float r = texture(tex, uvR).r;
-    float g = texture(tex, uvG).g;
-    float b = texture(tex, uvB).b;
-
-    return vec3(r, g, b);
-}
-
-// Scanlines orizontale
-float scanlineHorizontal(vec2 uv, float intensity) {
-    float line = sin(uv.y * resolution.y * 2.0) * 0.5 + 0.5;
-    return 1.0 - (line * intensity);
-}
-
-// Scanlines verticale
-float scanlineVertical(vec2 uv, float intensity) {
-    float line = sin(uv.x * resolution.x * 2.0) * 0.5 + 0.5;
-    return 1.0 - (line * intensity);
-}
-
-// Noise/flicker
-float noise(vec2 co) {
-    return fract(sin(dot(co.xy, vec2(12.9898, 78.233)) + time) * 43758.5453);
-}
-
-// Vignette (intuneca colturile)
-float vignette(vec2 uv, float intensity) {
-    vec2 pos = uv - 0.5;
-    float dist = length(pos);
-    return 1.0 - smoothstep(0.3, 0.8, dist) * intensity;
-}
+out vec4 finalColor;
 
 void main() {
     // Fara barrel distortion - folosim UV-urile normale
     vec2 uv = fragTexCoord;
 
-    // Chromatic aberration (subtil, ca in Nodebuster)
-    vec3 color = chromaticAberration(texture0, uv, 1.5);
-
-    // Aplicare scanlines orizontale (subtile)
-    float scanH = scanlineHorizontal(uv, 0.15);
-    color *= scanH;
-
+#ifdef CRT_CHROMATIC_ABERRATION
+    // Chromatic aberration (subtil, ca in Nodebuster): amount 1.5 * 0.003
+    vec2 shift = (uv - 0.5) * 0.0045;
+    vec3 color = vec3(
+        texture(texture0, uv + shift).r,
+        texture(texture0, uv).g,
+        texture(texture0, uv - shift).b);
+#else
+    vec3 color = texture(texture0, uv).rgb;
+#endif
+
+#if defined(CRT_SCANLINES) || defined(CRT_VIGNETTE)
+    // Texel centers line up with pixel centers vertically, so rows are exact
+    vec2 mask = texture(maskLut, gl_FragCoord.xy / resolution).ra;
+#endif
+
+#ifdef CRT_SCANLINES
+    // Scanlines orizontale (subtile)
+    color *= mask.x;
+#endif
+
+#ifdef CRT_NOISE
     // Noise flicker foarte fin
-    float noiseVal = noise(uv * time * 0.01) * 0.02;
-    color += vec3(noiseVal);
+    vec2 noiseUv = gl_FragCoord.xy / vec2(textureSize(blueNoise, 0)) + noiseOffset;
+    color += vec3(texture(blueNoise, noiseUv).r * 0.02);
+#endif
 
+#ifdef CRT_VIGNETTE
     // Vignette usor
-    float vig = vignette(uv, 0.3);
-    color *= vig;
+    color *= mask.y;
+#endif
 
-    // Flicker random foarte subtil (TV vechi)
-    float flicker = 1.0 + sin(time * 10.0) * 0.01;
     color *= flicker;
 
     // Gamma correction pentru aspect mai "analog"
@@ -0,0 +1,20 @@
+#version 330
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+out vec4 finalColor;
+
+// The atlas alpha is a distance field: 0.5 on the glyph outline, higher inside
+void main() {
+    float distance = texture(texture0, fragTexCoord).a - 0.5;
+
+    // Width of one screen pixel in distance units, so edges stay ~1px soft at any scale
+    float pixelWidth = max(length(vec2(dFdx(distance), dFdy(distance))), 1e-4);
+    float coverage = smoothstep(-pixelWidth, pixelWidth, distance);
+
+    finalColor = vec4(fragColor.rgb, fragColor.a * coverage) * colDiffuse;
+}
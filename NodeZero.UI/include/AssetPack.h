@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @class AssetPack
+ * @brief The fonts and shaders, compiled into the executable as one indexed byte array.
+ *
+ * The build packs NodeZero.UI/assets/fonts and assets/shaders into a generated source file
+ * (see cmake/EmbedAssets.cmake), so the game needs no assets folder next to it and loading
+ * an asset is a lookup: the data is used where it lies, never copied or read from disk.
+ * Each asset is followed by a zero byte, so text assets are valid C strings.
+ */
+class AssetPack {
+public:
+    /** @brief An embedded file; data is null if there was no asset at the requested path. */
+    struct Asset {
+        const unsigned char* data{ nullptr };
+        int size{ 0 };
+
+        bool IsValid() const { return data != nullptr; }
+
+        /** @brief The contents as a zero-terminated string (shader source), or nullptr. */
+        const char* GetText() const { return reinterpret_cast<const char*>(data); }
+    };
+
+    /** @brief Looks up an asset by its path under assets/, e.g. "shaders/crt.fs". */
+    static Asset Find(const char* path);
+
+private:
+    struct Entry {
+        const char* path;
+        size_t offset;
+        size_t size;
+    };
+
+    // Defined in the generated EmbeddedAssets.cpp
+    static const unsigned char BLOB[];
+    static const Entry INDEX[];
+    static const size_t ENTRY_COUNT;
+};
@@ -1,6 +1,5 @@
 #pragma once
 #include <iostream>
-#include <memory>
 #include <string>
 
 #include "Events/GameEvents.h"
@@ -18,12 +17,10 @@ public:
     EventLogger() = default;
     virtual ~EventLogger() = default;
 
-    void Update(const std::shared_ptr<IEvent>& event) override {
-        if (!event) return;
+    void Update(const IEvent& event) override {
+        const GameEvent& gameEvent = static_cast<const GameEvent&>(event);
 
-        auto gameEvent = std::static_pointer_cast<GameEvent>(event);
-
-        switch (gameEvent->type) {
+        switch (gameEvent.type) {
         case EventType::NodeSpawned:      LogNodeSpawn(gameEvent); break;
         case EventType::NodeDestroyed:    LogNodeDestroy(gameEvent); break;
         case EventType::NodeDamaged:      LogNodeDamage(gameEvent); break;
@@ -40,27 +37,27 @@ private:
         std::cout << "[GAME EVENT] " << msg << std::endl;
     }
 
-    void LogNodeSpawn(const std::shared_ptr<GameEvent>& e) {
-        Log("Spawn: Node at (" + std::to_string(e->position.x) + ", " + std::to_string(e->position.y) + ")");
+    void LogNodeSpawn(const GameEvent& e) {
+        Log("Spawn: Node at (" + std::to_string(e.position.x) + ", " + std::to_string(e.position.y) + ")");
     }
 
-    void LogNodeDestroy(const std::shared_ptr<GameEvent>& e) {
-        Log("Destroy: Points gained: " + std::to_string(e->points));
+    void LogNodeDestroy(const GameEvent& e) {
+        Log("Destroy: Points gained: " + std::to_string(e.points));
     }
 
-    void LogNodeDamage(const std::shared_ptr<GameEvent>& e) {
-        Log("Damage: " + std::to_string(e->damage) + " dealt. Remaining HP: " + std::to_string(e->hp));
+    void LogNodeDamage(const GameEvent& e) {
+        Log("Damage: " + std::to_string(e.damage) + " dealt. Remaining HP: " + std::to_string(e.hp));
     }
 
-    void LogBossSpawn(const std::shared_ptr<GameEvent>& e) {
-        Log("BOSS SPAWN: Level " + std::to_string(e->level) + ", HP: " + std::to_string(e->bossHP));
+    void LogBossSpawn(const GameEvent& e) {
+        Log("BOSS SPAWN: Level " + std::to_string(e.level) + ", HP: " + std::to_string(e.bossHP));
     }
 
-    void LogBossDefeat(const std::shared_ptr<GameEvent>& e) {
-        Log("BOSS DEFEATED: Level " + std::to_string(e->level));
+    void LogBossDefeat(const GameEvent& e) {
+        Log("BOSS DEFEATED: Level " + std::to_string(e.level));
     }
 
-    void LogLevelComplete(const std::shared_ptr<GameEvent>& e) {
-        Log("LEVEL COMPLETE: Advancing to Level " + std::to_string(e->nextLevel));
+    void LogLevelComplete(const GameEvent& e) {
+        Log("LEVEL COMPLETE: Advancing to Level " + std::to_string(e.nextLevel));
     }
 };
\ No newline at end of file
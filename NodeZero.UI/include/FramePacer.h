@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class FramePacer
+ * @brief Holds the main loop to a fixed frame rate with even frame spacing.
+ *
+ * Replaces raylib's SetTargetFPS wait. The pacer sleeps on an absolute monotonic
+ * deadline (clock_nanosleep on Linux) until shortly before the frame is due, then
+ * spins for the rest. The spin tail adapts to the sleep overshoot the pacer measures
+ * itself: it grows at once when the OS wakes it late, and shrinks slowly while wake-ups
+ * are punctual, so little CPU is burnt spinning.
+ *
+ * Deadlines advance by exactly one period, so an early or late frame does not shift
+ * the ones after it. A frame that misses its deadline by a whole period resynchronises
+ * the cadence instead of running the following frames back to back.
+ *
+ * In present prediction mode the deadline is when the frame should be presented: the
+ * pacer learns how long frames take from start to present and starts each one just
+ * that long before its deadline, so input is sampled as late as possible.
+ */
+class FramePacer {
+public:
+    explicit FramePacer(int targetFps);
+
+    /** @brief Changes the frame rate; the cadence and the learned frame time start over. */
+    void SetTargetFps(int targetFps);
+
+    /** @brief Start frames so that they present on the deadline, rather than start on it. */
+    void SetPresentPrediction(bool enabled);
+
+    /** @brief Keep frame intervals for PrintSummary() while on. Measurement mode only. */
+    void SetKeepStats(bool keep);
+
+    /** @brief Call once per frame, after presenting. Returns when the next frame should start. */
+    void Wait();
+
+    /** @brief Prints frame interval percentiles and how the wait time was split. */
+    void PrintSummary() const;
+
+private:
+    /** @brief Sleeps, then spins, until `deadline` (monotonic nanoseconds). */
+    void WaitUntil(int64_t deadline);
+
+    /** @brief Monotonic clock in nanoseconds. */
+    static int64_t Now();
+
+    int64_t m_Period;          // Nanoseconds per frame
+    int64_t m_NextDeadline{ 0 };
+    int64_t m_FrameStart{ 0 };  // When the current frame started (the last Wait() returned)
+    int64_t m_SpinMargin;       // Spin this long before a deadline instead of sleeping
+    int64_t m_PredictedWork{ 0 }; // Start-to-present time of recent frames (prediction mode)
+    bool m_PredictPresent{ false };
+
+    // Measurement mode
+    bool m_KeepStats{ false };
+    std::vector<float> m_Intervals; // Milliseconds between frame starts
+    int64_t m_SleepTime{ 0 };
+    int64_t m_SpinTime{ 0 };
+    int64_t m_LastStart{ 0 };
+    bool m_SkipInterval{ true }; // The first interval after switching stats on spans the gap
+
+    static constexpr int64_t NANOSECONDS_PER_SECOND = 1000000000;
+    static constexpr int64_t INITIAL_SPIN_MARGIN = 1000000;  // 1 ms, until overshoot has been measured
+    static constexpr int64_t MIN_SPIN_MARGIN = 50000;        // 50 us
+    static constexpr int64_t MAX_SPIN_MARGIN = 3000000;      // 3 ms; beyond that, sleeping is hopeless anyway
+    static constexpr float SPIN_SAFETY = 1.5f;               // Margin kept over the measured overshoot
+    static constexpr int SPIN_SHRINK_RATE = 32;              // Margin closes 1/32 of the gap per punctual frame
+    static constexpr float WORK_SAFETY = 1.2f;               // Prediction: start a little earlier than measured
+    static constexpr int WORK_DECAY_RATE = 64;               // Prediction: a slow frame is forgotten gradually
+};
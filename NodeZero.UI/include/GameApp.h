@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <memory>
 #include "Enums/GameScreen.h"
+#include "Rendering/SdfFont.h"
 #include "raylib.h"
 
 // Forward Declarations
@@ -12,6 +15,13 @@ class PauseScreen;
 class UpgradesScreen;
 class LevelCompletedScreen;
 class GameoverScreen;
+class CrtPass;
+class ShaderCache;
+class DynamicResolution;
+class QualityGovernor;
+class SimulationThread;
+class InputLatencyLog;
+class FramePacer;
 
 /**
  * @class GameApp
@@ -29,13 +39,57 @@ class GameApp {
     /** @brief Starts the main application loop. Blocking call. */
     void Run();
 
+    /** @brief Measurement mode: log input-sample-to-present latency per frame. Call before Run(). */
+    void EnableLatencyLog();
+
+    /** @brief Pace frames to present on the frame deadline instead of starting on it. Call before Run(). */
+    void EnablePresentPrediction();
+
    private:
+    /**
+     * @brief Opens the window, then loads in stages: file reads and CPU baking run on worker
+     * threads while the window shows loading frames, and GPU uploads follow on this thread.
+     * Prints the time to the first frame and until the first menu is ready.
+     */
     void Initialize();
     void Update();
     void Draw();
     void Cleanup();
 
-    /** @brief Switches the active screen (State Machine transition). */
+    /** @brief Presents one frame of the loading screen (default font, no assets needed). */
+    void DrawLoadingFrame();
+
+    /** @brief Uploads the SDF font and compiles its text shader, falling back to the default font. */
+    void LoadTextFont(SdfFont::Data& fontData);
+
+    // Menu screens past the main menu are built the first time they are shown
+    PauseScreen& GetPauseScreen();
+    UpgradesScreen& GetUpgradesScreen();
+    LevelCompletedScreen& GetLevelCompletedScreen();
+    GameoverScreen& GetGameoverScreen();
+
+    /**
+     * @brief Feeds the last frame time to the quality governor and the resolution controller,
+     * and applies the CRT part of the quality tier.
+     */
+    void UpdateQuality(bool gameplayVisible);
+
+    /** @brief Resizes the scene target when the render scale changed step. */
+    void UpdateRenderScale();
+
+    /**
+     * @brief Low-power mode while the simulation is not running: frames are drawn only
+     * when input arrives (raylib event waiting), at most IDLE_FPS times a second.
+     */
+    void SetIdle(bool idle);
+
+    /** @brief Renders the gameplay screen once into m_FrozenGameplay, which menus then show behind them. */
+    void FreezeGameplay();
+
+    /**
+     * @brief Switches the active screen (State Machine transition).
+     * Leaving Playing pauses the simulation first, so the new screen can use the game directly.
+     */
     void ChangeState(GameScreen newState);
 
     // State Management
@@ -45,8 +99,10 @@ class GameApp {
 
     // Core Systems
     std::unique_ptr<IGame> m_Game; // The Logic Engine
+    std::unique_ptr<SimulationThread> m_Simulation; // Ticks m_Game while Playing; owns it until paused
 
-    // Screens (View Controllers)
+    // Screens (View Controllers); null until first use, except the gameplay and main screens
+    std::function<void(GameScreen)> m_StateChangeCallback;
     std::shared_ptr<GameplayScreen> m_GameplayScreen;
     std::unique_ptr<MainScreen> m_MainScreen;
     std::unique_ptr<PauseScreen> m_PauseScreen;
@@ -55,16 +111,47 @@ class GameApp {
     std::unique_ptr<GameoverScreen> m_GameoverScreen;
 
     // Global Rendering Resources
-    RenderTexture2D m_RenderTarget; // Used for Post-Processing (CRT Effect)
-    Shader m_CrtShader;
-    int m_ResolutionLoc;
-    int m_TimeLoc;
+    RenderTexture2D m_RenderTarget; // Scene at the dynamic render scale, upscaled by the CRT pass
+    std::unique_ptr<DynamicResolution> m_Resolution;
+    std::unique_ptr<QualityGovernor> m_Governor; // Effect tiers (reflections, bloom, particles, CRT)
+    RenderTexture2D m_NodeLayer;    // Nodes rendered once, composited for reflection + main pass
+    std::unique_ptr<ShaderCache> m_ShaderCache; // Linked program binaries, kept in the save data directory
+    std::unique_ptr<CrtPass> m_CrtPass; // CRT post-process variants and their lookup textures
     float m_ElapsedTime;
     Font m_Font;
+    Shader m_TextShader; // SDF text shader, applied by the raylib backend to m_Font draws
+    bool m_OwnsFont;     // False when falling back to raylib's default font
+    Texture2D m_GlowTexture; // Shared bloom sprite, generated once at startup
+    Texture2D m_ParticleTexture; // Disc sprite for damage particles
+
+    bool m_LogLatency;
+    std::unique_ptr<InputLatencyLog> m_LatencyLog; // Open only in measurement mode
+
+    bool m_PredictPresent;
+    std::unique_ptr<FramePacer> m_Pacer; // Holds TARGET_FPS in place of raylib's SetTargetFPS wait
+
+    // Idle mode (menus, pause, game over)
+    bool m_Idle;
+    int m_StaleFrameTimes; // Frames whose GetFrameTime() still includes an idle wait
+    RenderTexture2D m_FrozenGameplay; // Last gameplay frame, shown behind the pause/level/game over menus
+    bool m_GameplayFrozen;
+
+    std::chrono::steady_clock::time_point m_StartTime; // Construction, for the startup timings
     
     // Constants
     static constexpr int TARGET_FPS = 240;
+    static constexpr int IDLE_FPS = 60; // Cap on event-driven redraws (e.g. a stream of mouse moves)
+    static constexpr int STALE_FRAME_TIMES = 2; // raylib reports a frame's time one frame late
+    static constexpr Color SCENE_BACKGROUND{ 40, 40, 40, 255 };
+    static constexpr int FALLBACK_REFRESH_RATE = 60; // If the monitor does not report one
+    static constexpr int GLOW_TEXTURE_SIZE = 128;
+    static constexpr int PARTICLE_TEXTURE_SIZE = 32;
     static constexpr const char* WINDOW_TITLE = "NodeZero";
-    static constexpr const char* FONT_PATH = "assets/fonts/ari-w9500-display.ttf";
-    static constexpr const char* SHADER_PATH = "assets/shaders/crt.fs";
+    static constexpr const char* LOADING_TEXT = "LOADING";
+    static constexpr int LOADING_FONT_SIZE = 40;
+    // Embedded asset paths (see AssetPack), relative to NodeZero.UI/assets
+    static constexpr const char* FONT_ASSET = "fonts/ari-w9500-display.ttf";
+    static constexpr const char* SHADER_ASSET = "shaders/crt.fs";
+    static constexpr const char* TEXT_SHADER_ASSET = "shaders/sdf_text.fs";
+    static constexpr const char* LATENCY_LOG_FILE_NAME = "input_latency.csv";
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Rendering/IRenderBackend.h"
+#include "raylib.h"
+
+/**
+ * @class GeometryBatch
+ * @brief CPU-side triangle stream that is submitted to the GPU in one go.
+ *
+ * Shapes (fills, outlines, thick lines) are appended as plain colored
+ * triangles and handed to the render backend as one triangle list, so a whole
+ * render pass costs one draw call instead of several per entity.
+ * The vertex storage is kept between frames to avoid reallocations.
+ */
+class GeometryBatch {
+public:
+    GeometryBatch();
+
+    /** @brief Discards all queued geometry (capacity is kept). */
+    void Clear();
+
+    /** @brief Queues a single filled triangle. */
+    void AddTriangle(Vector2 a, Vector2 b, Vector2 c, Color color);
+
+    /** @brief Queues a filled quad given its four corners in winding order. */
+    void AddQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d, Color color);
+
+    /** @brief Queues a thick line segment as a quad. */
+    void AddLine(Vector2 start, Vector2 end, float thickness, Color color);
+
+    /**
+     * @brief Queues a filled convex polygon as a triangle fan.
+     * @param vertices Polygon outline in winding order.
+     * @param count Number of vertices (must be >= 3 to emit anything).
+     */
+    void AddConvexPolygon(const Vector2* vertices, int count, Color color);
+
+    /**
+     * @brief Queues the outline of a closed polygon, thickened inwards.
+     * @param outer Outer ring of vertices.
+     * @param inner Inner ring of vertices (same count as outer).
+     * @param count Number of vertices per ring.
+     */
+    void AddPolygonRing(const Vector2* outer, const Vector2* inner, int count, Color color);
+
+    /** @brief Sends every queued triangle to the backend and clears the batch. */
+    void Submit(IRenderBackend& backend);
+
+    /** @brief Number of vertices currently queued. */
+    size_t GetVertexCount() const;
+
+private:
+    std::vector<ColorVertex> m_Vertices;
+
+    static constexpr size_t INITIAL_VERTEX_CAPACITY = 16384;
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+
 #include "raylib.h"
 
 /**
@@ -15,6 +18,19 @@ public:
     /** @brief Gets the current mouse cursor position in screen coordinates. */
     static Vector2 GetMousePosition();
 
+    /**
+     * @brief Asks the OS for the cursor position now, instead of the value polled at the end of last frame.
+     * Used to late-latch cursor-relative draws right before they are submitted; each call is
+     * recorded as the latest input sample. Falls back to GetMousePosition() off desktop GLFW.
+     */
+    static Vector2 GetLatestMousePosition();
+
+    /** @brief When the last GetLatestMousePosition() call sampled the cursor. */
+    static std::chrono::steady_clock::time_point GetLastSampleTime();
+
+    /** @brief Number of GetLatestMousePosition() calls so far (tells frames with a fresh sample apart). */
+    static uint64_t GetSampleCount();
+
     /** @brief Checks if a mouse button was pressed in this frame. */
     static bool IsMouseButtonPressed(int button);
 
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class InputLatencyLog
+ * @brief Measurement mode: logs the input-sample-to-present latency of every frame.
+ *
+ * The sample is the late-latched cursor read (InputHandler::GetLatestMousePosition)
+ * that placed the cursor-relative draws; present is when EndDrawing() returns. Each
+ * frame with a fresh sample appends "frame,latency_ms" to a CSV file, and a summary
+ * (average, median, 99th percentile) is printed when the log is closed.
+ */
+class InputLatencyLog {
+public:
+    InputLatencyLog() = default;
+    ~InputLatencyLog();
+
+    InputLatencyLog(const InputLatencyLog&) = delete;
+    InputLatencyLog& operator=(const InputLatencyLog&) = delete;
+
+    /** @return False if the file could not be created (logging stays off). */
+    bool Open(const std::string& path);
+
+    bool IsOpen() const;
+
+    /** @brief Call right after the frame is presented. Frames without a new input sample are skipped. */
+    void RecordPresent();
+
+    /** @brief Prints the summary and closes the file. */
+    void Close();
+
+private:
+    std::ofstream m_File;
+    std::string m_Path;
+    std::vector<float> m_Latencies; // Milliseconds, kept for the summary
+    uint64_t m_LastSampleCount{ 0 };
+    uint64_t m_Frame{ 0 };
+};
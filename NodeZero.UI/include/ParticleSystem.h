@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SpriteBatch.h"
+#include "raylib.h"
+
+/**
+ * @struct ParticleBurst
+ * @brief Parameters for one Emit() call (all particles start at the same point).
+ */
+struct ParticleBurst {
+    Vector2 position;
+    Color baseColor;
+    int count;
+    float speedMin;
+    float speedMax;
+    float sizeMin;
+    float sizeMax;
+    float lifetime;
+    int colorVariance; // Max per-channel deviation from baseColor
+};
+
+/**
+ * @class ParticleSystem
+ * @brief Fixed-capacity particle pool stored as structure-of-arrays in a ring buffer.
+ *
+ * Each attribute lives in its own contiguous array, so the per-frame integration
+ * (motion, gravity, aging) is a set of branch-free loops the compiler vectorizes.
+ * New particles are written at the head of the ring; when the pool is full the
+ * oldest particles are recycled instead of dropping the new burst. Particles
+ * retire from the tail once expired, which keeps the live range contiguous
+ * (lifetimes are expected to be roughly uniform; an expired particle that is not
+ * yet at the tail is simply invisible until it gets there).
+ */
+class ParticleSystem {
+public:
+    /**
+     * @param capacity Maximum live particles (rounded up to a power of two).
+     * @param gravity Downward acceleration applied to every particle (Pixels/s^2).
+     */
+    ParticleSystem(int capacity, float gravity);
+
+    /** @brief Spawns a burst with random directions, speeds, sizes and color jitter. */
+    void Emit(const ParticleBurst& burst);
+
+    /** @brief Integrates all live particles and retires the expired ones. */
+    void Update(float deltaTime);
+
+    /** @brief Appends one tinted quad per live particle to the batch (alpha fades with age). */
+    void Draw(SpriteBatch& batch) const;
+
+    /** @brief Removes every particle. */
+    void Clear();
+
+    int GetCount() const;
+    int GetCapacity() const;
+
+private:
+    void IntegrateSpan(int begin, int end, float deltaTime);
+    void DrawSpan(int begin, int end, SpriteBatch& batch) const;
+
+    /** @brief xorshift32: a few integer ops per number, no shared state like rand(). */
+    uint32_t NextRandom();
+    float NextFloat(); // [0, 1)
+
+    int m_Capacity;
+    int m_Mask;
+    int m_Head{ 0 };  // Next slot to write
+    int m_Count{ 0 }; // Live particles, ending just before m_Head
+    float m_Gravity;
+    uint32_t m_RandomState{ 0x9E3779B9u };
+
+    std::vector<float> m_PositionX;
+    std::vector<float> m_PositionY;
+    std::vector<float> m_VelocityX;
+    std::vector<float> m_VelocityY;
+    std::vector<float> m_Age;
+    std::vector<float> m_InverseLifetime;
+    std::vector<float> m_Size;
+    std::vector<Color> m_Colors; // Alpha is derived from age when drawing
+};
@@ -1,21 +1,49 @@
 #pragma once
 
+#include "GeometryBatch.h"
+#include "Rendering/IRenderBackend.h"
 #include "raylib.h"
 
+class QualityGovernor;
+
 /**
  * @class Renderer
  * @brief Static utility class for all game rendering operations.
  *
  * Encapsulates the logic for drawing geometric shapes, UI elements,
  * and complex entity visuals (like the health-fill effect on nodes).
- * Relies on Raylib for low-level drawing calls.
+ * All low-level drawing goes through the active IRenderBackend (raylib by
+ * default, see SetBackend). Node shapes are not drawn
+ * immediately; they are appended to a GeometryBatch that the caller submits
+ * once per pass.
  */
 class Renderer {
 public:
+    // --- Backend ---
+
+    /**
+     * @brief Redirects all drawing (Renderer and GameplayScreen) to another backend.
+     * @param backend Backend to use, or nullptr to restore the raylib backend. Not owned.
+     */
+    static void SetBackend(IRenderBackend* backend);
+
+    /** @brief The backend currently receiving draw commands. */
+    static IRenderBackend& GetBackend();
+
+    /**
+     * @brief Draws text in the given font through shader on the raylib backend (see SdfFont).
+     * Applies to the default backend only; the null and recording backends ignore shaders.
+     */
+    static void SetTextShader(Font font, Shader shader);
+
     // --- Entity Drawing ---
 
     /**
      * @brief Draws a circular node with a health-fill effect.
+     *
+     * The segment count is picked from the radius out of a few precomputed LOD
+     * tables, so small nodes are cheap and large ones (boss-sized) stay smooth.
+     * @param batch The batch receiving the node's triangles.
      * @param x Center X coordinate.
      * @param y Center Y coordinate.
      * @param size Radius of the circle.
@@ -23,21 +51,39 @@ public:
      * @param color Base color of the entity.
      * @param rotation Rotation in degrees.
      */
-    static void DrawCircleNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+    static void DrawCircleNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
 
     /** @brief Draws a square node with health-fill effect. */
-    static void DrawSquareNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+    static void DrawSquareNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
 
     /** @brief Draws a hexagonal node with health-fill effect. */
-    static void DrawHexagonNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+    static void DrawHexagonNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+
+    /**
+     * @brief Generates the soft radial glow sprite used by the bloom pass.
+     *
+     * White at the center fading linearly to transparent at the edge, so tinting it
+     * reproduces DrawCircleGradient(color, Fade(color, 0)). Call once after the window exists.
+     * @param size Width and height of the texture in pixels.
+     */
+    static Texture2D GenerateGlowTexture(int size);
+
+    /**
+     * @brief Generates a filled white disc with a soft edge, used for particle sprites.
+     * Tinting it replaces a DrawCircleV per particle with a single textured quad.
+     */
+    static Texture2D GenerateDiscTexture(int size);
 
     /** @brief Draws a simple cross/plus shape for pickups. */
     static void DrawPickup(float x, float y, float size, Color color);
 
     // --- UI Drawing ---
 
-    /** @brief Draws FPS and debug counters. */
-    static void DrawDebugInfo(int posX, int posY, Font font);
+    /**
+     * @brief Draws FPS and debug counters (live / peak node count and draw calls below the FPS).
+     * With a governor, the effect quality tier and its last step are listed underneath.
+     */
+    static void DrawDebugInfo(int posX, int posY, Font font, int liveNodes, int peakNodes, int drawCalls, const QualityGovernor* governor = nullptr);
 
     /** @brief Draws the player's score counter. */
     static void DrawPoints(int points, int posX, int posY, int fontSize, Color color, Font font);
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+
+class ShaderCache;
+
+/**
+ * @class CrtPass
+ * @brief Full-screen CRT post-process: owns the shader variants and their lookup textures.
+ *
+ * Terms that do not change between frames are baked once at load time instead of
+ * being evaluated per pixel: the scanline pattern and the vignette mask share one
+ * small lookup texture (one row per screen row, a few columns across, since the
+ * vignette is smooth), and the per-pixel hash noise is replaced by a tiled
+ * blue-noise texture shifted every frame. Flicker is a single per-frame uniform.
+ *
+ * Each effect is a preprocessor switch in crt.fs. A variant is compiled on demand
+ * for every combination passed to SetEffects(), so disabled effects cost nothing
+ * instead of being branched over.
+ *
+ * Preparing the source and baking the lookup tables is CPU work (Prepare()), which can
+ * run on a worker thread while the window shows a loading frame; Load() then only
+ * uploads the results.
+ */
+class CrtPass {
+public:
+    /** @brief Effect switches, combined as a bit mask. */
+    enum Effect : unsigned int {
+        CHROMATIC_ABERRATION = 1u << 0,
+        SCANLINES = 1u << 1,
+        NOISE = 1u << 2,
+        VIGNETTE = 1u << 3,
+        ALL_EFFECTS = CHROMATIC_ABERRATION | SCANLINES | NOISE | VIGNETTE
+    };
+
+    /** @brief Shader source and lookup-table pixels, built without touching the GPU. */
+    struct Assets {
+        std::string source; // crt.fs without its #version line
+        std::vector<unsigned char> maskPixels;
+        std::vector<unsigned char> noisePixels;
+        int screenHeight{ 0 };
+    };
+
+    CrtPass() = default;
+    ~CrtPass();
+
+    CrtPass(const CrtPass&) = delete;
+    CrtPass& operator=(const CrtPass&) = delete;
+
+    /** @brief Takes the crt.fs source and bakes the lookup tables for this output height. Safe on any thread. */
+    static Assets Prepare(const char* shaderSource, int screenHeight);
+
+    /**
+     * @brief Uploads the lookup textures and compiles the first variant.
+     * Call after the window exists, on its thread. Starts with ALL_EFFECTS.
+     */
+    void Load(const Assets& assets, int screenWidth);
+
+    /** @brief Variants are loaded through this cache when set (call before Load()); not owned. */
+    void SetShaderCache(ShaderCache* cache) { m_ShaderCache = cache; }
+
+    /** @brief Compiles the variant for this combination now, so switching to it later does not stall. */
+    void Precompile(unsigned int effects);
+
+    /** @brief Selects the variant used by Draw(). */
+    void SetEffects(unsigned int effects);
+
+    /** @brief Computes this frame's flicker and noise offset. */
+    void Update(float time);
+
+    /** @brief Draws the scene texture (stored flipped, as render textures are) stretched over the screen. */
+    void Draw(Texture2D scene);
+
+    void Unload();
+
+private:
+    struct Variant {
+        unsigned int effects;
+        Shader shader;
+        int resolutionLoc;
+        int maskLoc;
+        int noiseLoc;
+        int noiseOffsetLoc;
+        int flickerLoc;
+    };
+
+    Variant& GetVariant(unsigned int effects);
+
+    /** @brief Scanline factor (gray) and vignette (alpha), baked from the formulas crt.fs used per pixel. */
+    static std::vector<unsigned char> GenerateMask(int screenHeight);
+
+    /** @brief Void-and-cluster blue noise: ranks spread so neighboring texels never clump. */
+    static std::vector<unsigned char> GenerateBlueNoise(int size);
+
+    std::string m_Source; // crt.fs without its #version line; defines are inserted before it
+    std::vector<Variant> m_Variants;
+    ShaderCache* m_ShaderCache{ nullptr };
+    unsigned int m_Effects{ ALL_EFFECTS };
+
+    Texture2D m_MaskTexture{};
+    Texture2D m_NoiseTexture{};
+    int m_ScreenWidth{ 0 };
+    int m_ScreenHeight{ 0 };
+    float m_Flicker{ 1.0f };
+    Vector2 m_NoiseOffset{ 0.0f, 0.0f };
+
+    static constexpr int MASK_WIDTH = 64;       // Vignette columns; bilinear filtering fills the rest
+    static constexpr int NOISE_SIZE = 64;       // Blue-noise tile, repeated across the screen
+    static constexpr float NOISE_STEPS_PER_SECOND = 60.0f;
+    static constexpr const char* GLSL_VERSION = "#version 330\n";
+};
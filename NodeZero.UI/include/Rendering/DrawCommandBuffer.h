@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Rendering/IRenderBackend.h"
+
+/**
+ * @enum DrawLayer
+ * @brief Painter's order buckets. Commands never move across layers when sorted.
+ */
+enum class DrawLayer : unsigned char {
+    Reflection,     // Node layer reflection
+    ZoneReflection, // Damage zone reflection
+    Bloom,          // Glow sprites
+    World,          // Node layer
+    Effects,        // Pickups and particles
+    Overlay,        // Damage zone and crosshair
+    Hud             // Bars and text
+};
+
+/**
+ * @class DrawCommandBuffer
+ * @brief Deferring backend that sorts a frame's draws to minimise batch breaks.
+ *
+ * While recording, draw calls are stored (with their vertex data and text copied)
+ * and keyed by layer, texture and primitive mode. Submit() stable-sorts the keys
+ * and replays the commands into the real backend, so consecutive commands share
+ * rlgl state and are merged into the same draw. Order is kept between layers and
+ * between commands with identical keys; only state-incompatible commands inside
+ * one layer are reordered, so a layer must only contain draws that may be
+ * reordered by texture/primitive without a visible difference.
+ *
+ * Each command remembers the translation active when it was recorded and is
+ * replayed under it (only translations are supported). Render target changes
+ * are barriers: pending commands are submitted first.
+ *
+ * Commands recorded between BeginAnchored() and EndAnchored() are also moved by
+ * the anchor, which may be set any time before Submit(). Cursor-relative draws
+ * use it to late-latch the mouse: they are recorded around the origin and placed
+ * at a cursor position sampled right before replay.
+ */
+class DrawCommandBuffer : public IRenderBackend {
+public:
+    DrawCommandBuffer();
+
+    /** @brief Starts recording a frame and zeroes the draw call counts. Queries and barriers are forwarded to target. */
+    void Begin(IRenderBackend& target);
+
+    /** @brief Selects the layer of subsequently recorded commands. */
+    void SetLayer(DrawLayer layer);
+
+    /** @brief Commands recorded until EndAnchored() are replayed offset by the anchor. */
+    void BeginAnchored();
+    void EndAnchored();
+
+    /** @brief Offset applied to anchored commands by the next Submit() (reset to zero afterwards). */
+    void SetAnchor(Vector2 anchor);
+
+    /** @brief Sorts and replays every recorded command into the target, then clears the buffer. */
+    void Submit();
+
+    /**
+     * @brief Draw calls replayed since Begin(), over every Submit() of the frame.
+     * A run of commands sharing texture and primitive mode is one rlgl draw call, as
+     * RenderStats::drawCalls counts them; batch flushes (buffer overflows, barriers) are not modeled.
+     */
+    int GetDrawCallCount() const;
+
+    /** @brief Draw calls the same commands would have taken in recorded (unsorted) order. */
+    int GetUnsortedDrawCallCount() const;
+
+    // --- IRenderBackend ---
+    int GetScreenWidth() const override;
+    int GetScreenHeight() const override;
+    int GetFPS() const override;
+
+    void BeginTextureMode(RenderTexture2D target) override;
+    void EndTextureMode() override;
+    void ClearBackground(Color color) override;
+    void PushMatrix() override;
+    void Translate(float x, float y) override;
+    void PopMatrix() override;
+
+    void DrawTriangles(const ColorVertex* vertices, int vertexCount) override;
+    void DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) override;
+
+    void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) override;
+    void DrawRectangle(int posX, int posY, int width, int height, Color color) override;
+    void DrawRectangleLines(int posX, int posY, int width, int height, Color color) override;
+    void DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) override;
+    void DrawCircleV(Vector2 center, float radius, Color color) override;
+
+    Vector2 MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const override;
+    void DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) override;
+
+private:
+    // Sort order inside one texture: fills first, then thin geometry on top
+    enum class Primitive : unsigned char { Quads, Triangles, Lines };
+
+    enum class CommandType : unsigned char {
+        Triangles, TexturedQuads, TextureRec, Rectangle, RectangleLines, LineEx, CircleV, TextEx
+    };
+
+    struct DrawCommand {
+        CommandType type;
+        Texture2D texture;  // TexturedQuads, TextureRec
+        Font font;          // TextEx
+        Rectangle rect;     // Rectangle / RectangleLines (integer coords), TextureRec source
+        Vector2 a;          // Position / start / center
+        Vector2 b;          // LineEx end
+        float size;         // Thickness / radius / font size
+        float spacing;
+        Color color;
+        int dataOffset;     // Into the vertex or text storage
+        int dataCount;
+        Vector2 offset;     // Translation active at record time
+        bool anchored;      // Also moved by m_Anchor at replay
+    };
+
+    void Record(const DrawCommand& command, Primitive primitive, unsigned int textureId);
+    void Replay(const DrawCommand& command);
+
+    /** @brief Counts the draw calls along a key sequence: one per run of equal texture and primitive. */
+    static int CountDrawCalls(const std::vector<uint64_t>& keys, const std::vector<uint32_t>& order);
+
+    IRenderBackend* m_Target{ nullptr };
+    DrawLayer m_Layer{ DrawLayer::Reflection };
+    Vector2 m_Offset{ 0.0f, 0.0f };
+    std::vector<Vector2> m_OffsetStack;
+    bool m_Anchored{ false };
+    Vector2 m_Anchor{ 0.0f, 0.0f };
+
+    std::vector<DrawCommand> m_Commands;
+    std::vector<uint64_t> m_Keys;      // Parallel to m_Commands
+    std::vector<uint32_t> m_Order;     // Replay order (indices into m_Commands)
+    std::vector<ColorVertex> m_ColorVertices;
+    std::vector<TextureVertex> m_TextureVertices;
+    std::vector<char> m_Text;
+
+    int m_DrawCallCount{ 0 };
+    int m_UnsortedDrawCallCount{ 0 };
+
+    static constexpr size_t INITIAL_COMMAND_CAPACITY = 512;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * @class DynamicResolution
+ * @brief Picks the render scale of the offscreen scene target from measured frame times.
+ *
+ * The scene is drawn into a target of (screen size * scale) and upscaled by the
+ * CRT pass, so fill-rate heavy work (bloom, reflections, the CRT taps) shrinks
+ * with the square of the scale. Scales are quantized to a few steps so the
+ * target is only reallocated on an actual step change.
+ *
+ * In automatic mode the scale drops one step as soon as the smoothed frame time
+ * misses the budget, and is probed one step up after the budget has been held
+ * for a while. Each probe that fails doubles the wait before the next one, so a
+ * scale that cannot be sustained is not retried every few seconds.
+ */
+class DynamicResolution {
+public:
+    /** @param frameBudget Frame time to hold, in seconds (e.g. 1 / refresh rate). */
+    explicit DynamicResolution(float frameBudget);
+
+    /** @brief Feeds one frame time (seconds) and adjusts the scale in automatic mode. */
+    void Update(float frameTime);
+
+    /**
+     * @brief Pins the scale (snapped to the nearest step), or returns to automatic mode.
+     * @param scale Fixed scale in (0, 1], or AUTOMATIC.
+     */
+    void SetFixedScale(float scale);
+
+    bool IsAutomatic() const;
+
+    /** @brief Current scale of the scene target relative to the screen. */
+    float GetScale() const;
+
+    /** @brief Pass to SetFixedScale() to let frame times drive the scale. */
+    static constexpr float AUTOMATIC = 0.0f;
+
+private:
+    void StepDown();
+    void StepUp();
+
+    float m_FrameBudget;
+    float m_AverageFrameTime;
+    float m_TimeSinceChange;
+    float m_ProbeDelay;
+    bool m_IsProbing;
+    int m_Step;
+    bool m_IsAutomatic;
+
+    // Scale steps, from full resolution down to half (a quarter of the pixels)
+    static constexpr int STEP_COUNT = 5;
+    static constexpr float STEPS[STEP_COUNT] = { 1.0f, 0.875f, 0.75f, 0.625f, 0.5f };
+
+    static constexpr float SMOOTHING = 0.1f;            // Weight of the newest frame in the average
+    static constexpr float MISS_TOLERANCE = 1.1f;       // Average may exceed the budget by 10% (timer jitter)
+    static constexpr float MIN_TIME_BETWEEN_STEPS = 0.5f; // Let the average settle after a change
+    static constexpr float INITIAL_PROBE_DELAY = 3.0f;
+    static constexpr float MAX_PROBE_DELAY = 30.0f;
+};
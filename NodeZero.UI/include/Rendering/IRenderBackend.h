@@ -0,0 +1,65 @@
+#pragma once
+
+#include "raylib.h"
+
+/** @brief Untextured vertex used by triangle streams (see GeometryBatch). */
+struct ColorVertex {
+    float x;
+    float y;
+    Color color;
+};
+
+/** @brief Textured vertex used by quad streams (see SpriteBatch). */
+struct TextureVertex {
+    float x;
+    float y;
+    float u;
+    float v;
+    Color color;
+};
+
+/**
+ * @class IRenderBackend
+ * @brief Thin draw-command interface between the render code and the graphics API.
+ *
+ * Renderer and GameplayScreen issue every draw through this interface instead of
+ * the raylib globals. Method names mirror the raylib calls they replace, so the
+ * raylib backend is a straightforward forwarder, while the null and recording backends
+ * allow render preparation to run (and be measured) without a window or GL context.
+ */
+class IRenderBackend {
+public:
+    virtual ~IRenderBackend() = default;
+
+    // --- Target Info ---
+    virtual int GetScreenWidth() const = 0;
+    virtual int GetScreenHeight() const = 0;
+    virtual int GetFPS() const = 0;
+
+    // --- Targets and Transform ---
+    virtual void BeginTextureMode(RenderTexture2D target) = 0;
+    virtual void EndTextureMode() = 0;
+    virtual void ClearBackground(Color color) = 0;
+    virtual void PushMatrix() = 0;
+    virtual void Translate(float x, float y) = 0;
+    virtual void PopMatrix() = 0;
+
+    // --- Batched Geometry ---
+
+    /** @brief Draws a list of colored triangles (vertexCount is a multiple of 3). */
+    virtual void DrawTriangles(const ColorVertex* vertices, int vertexCount) = 0;
+
+    /** @brief Draws a list of textured quads (vertexCount is a multiple of 4, order TL, BL, BR, TR). */
+    virtual void DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) = 0;
+
+    // --- Immediate Primitives ---
+    virtual void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) = 0;
+    virtual void DrawRectangle(int posX, int posY, int width, int height, Color color) = 0;
+    virtual void DrawRectangleLines(int posX, int posY, int width, int height, Color color) = 0;
+    virtual void DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) = 0;
+    virtual void DrawCircleV(Vector2 center, float radius, Color color) = 0;
+
+    // --- Text ---
+    virtual Vector2 MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const = 0;
+    virtual void DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) = 0;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Rendering/IRenderBackend.h"
+
+/**
+ * @class NullRenderBackend
+ * @brief Discards every draw command. Needs no window or GL context.
+ *
+ * Reports a fixed virtual screen size and estimates text extents from the
+ * font size, so layout code runs unchanged in headless builds.
+ */
+class NullRenderBackend : public IRenderBackend {
+public:
+    NullRenderBackend(int screenWidth, int screenHeight);
+
+    int GetScreenWidth() const override;
+    int GetScreenHeight() const override;
+    int GetFPS() const override;
+
+    void BeginTextureMode(RenderTexture2D /*target*/) override {}
+    void EndTextureMode() override {}
+    void ClearBackground(Color /*color*/) override {}
+    void PushMatrix() override {}
+    void Translate(float /*x*/, float /*y*/) override {}
+    void PopMatrix() override {}
+
+    void DrawTriangles(const ColorVertex* /*vertices*/, int /*vertexCount*/) override {}
+    void DrawTexturedQuads(Texture2D /*texture*/, const TextureVertex* /*vertices*/, int /*vertexCount*/) override {}
+
+    void DrawTextureRec(Texture2D /*texture*/, Rectangle /*source*/, Vector2 /*position*/, Color /*tint*/) override {}
+    void DrawRectangle(int /*posX*/, int /*posY*/, int /*width*/, int /*height*/, Color /*color*/) override {}
+    void DrawRectangleLines(int /*posX*/, int /*posY*/, int /*width*/, int /*height*/, Color /*color*/) override {}
+    void DrawLineEx(Vector2 /*start*/, Vector2 /*end*/, float /*thickness*/, Color /*color*/) override {}
+    void DrawCircleV(Vector2 /*center*/, float /*radius*/, Color /*color*/) override {}
+
+    Vector2 MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const override;
+    void DrawTextEx(Font /*font*/, const char* /*text*/, Vector2 /*position*/, float /*fontSize*/, float /*spacing*/, Color /*color*/) override {}
+
+private:
+    int m_ScreenWidth;
+    int m_ScreenHeight;
+
+    // Average advance of a glyph relative to the font size (monospace estimate)
+    static constexpr float GLYPH_ADVANCE_RATIO = 0.6f;
+};
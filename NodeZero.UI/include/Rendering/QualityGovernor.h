@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+
+/**
+ * @brief Effect quality tiers, from everything on to the cheapest look.
+ * Each tier keeps the savings of the ones above it.
+ */
+enum class QualityTier {
+    Full,            // All effects
+    NoReflections,   // Offset node/zone reflections skipped
+    ReducedBloom,    // Smaller node glows (a third of the fill)
+    CappedParticles, // Fewer particles per hit and a low live cap
+    SimpleCrt,       // CRT pass with one texture tap, no scanlines or noise
+    Count
+};
+
+/** @brief The last tier change and the measurement that caused it. */
+struct QualityStep {
+    QualityTier from;
+    QualityTier to;
+    float percentileFrameTime; // Seconds
+};
+
+/**
+ * @class QualityGovernor
+ * @brief Steps the effect quality tier down and up from a rolling frame-time percentile.
+ *
+ * The 95th percentile of the last WINDOW_SIZE frames is compared with the frame
+ * budget. Quality drops one tier as soon as that percentile clearly misses the
+ * budget, and is raised one tier only after it has stayed under the budget for
+ * a hold time. The gap between the two thresholds plus the hold time form the
+ * hysteresis; a raise that fails straight away doubles the hold time, so an
+ * unsustainable tier is not retried every few seconds.
+ */
+class QualityGovernor {
+public:
+    /** @param frameBudget Frame time to hold, in seconds (1 / target FPS). */
+    explicit QualityGovernor(float frameBudget);
+
+    /**
+     * @brief Feeds one frame time (seconds) and steps the tier if needed.
+     * @param canRaise False to hold the tier down (e.g. while the render scale recovers first).
+     */
+    void Update(float frameTime, bool canRaise = true);
+
+    QualityTier GetTier() const;
+    bool IsLowestTier() const;
+
+    /** @brief Frame-time percentile of the current window, in seconds (0 until the window is full). */
+    float GetPercentileFrameTime() const;
+
+    /** @brief The most recent step; HasStepped() is false until the first one. */
+    const QualityStep& GetLastStep() const;
+    bool HasStepped() const;
+
+    /** @brief Readable tier name for the debug overlay. */
+    static const char* GetTierName(QualityTier tier);
+
+private:
+    void StepTo(QualityTier tier);
+    float ComputePercentile();
+
+    static constexpr int WINDOW_SIZE = 120;
+    static constexpr float PERCENTILE = 0.95f;
+    static constexpr float DOWN_THRESHOLD = 1.25f;     // Percentile above budget * this drops a tier
+    static constexpr float UP_THRESHOLD = 1.05f;       // Percentile below budget * this counts as healthy
+    static constexpr float INITIAL_UP_HOLD = 4.0f;     // Seconds of healthy frames before a raise
+    static constexpr float MAX_UP_HOLD = 60.0f;
+
+    std::array<float, WINDOW_SIZE> m_Samples{};
+    std::array<float, WINDOW_SIZE> m_Scratch{}; // Reordered by nth_element, keeps m_Samples intact
+    int m_SampleCount{ 0 };
+    int m_NextSample{ 0 };
+
+    float m_FrameBudget;
+    float m_Percentile{ 0.0f };
+    float m_HealthyTime{ 0.0f };
+    float m_TimeSinceStep{ 0.0f };
+    float m_UpHold{ INITIAL_UP_HOLD };
+    bool m_LastStepWasRaise{ false };
+
+    QualityTier m_Tier{ QualityTier::Full };
+    QualityStep m_LastStep{ QualityTier::Full, QualityTier::Full, 0.0f };
+    bool m_HasStepped{ false };
+};
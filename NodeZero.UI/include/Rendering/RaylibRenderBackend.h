@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Rendering/IRenderBackend.h"
+
+/**
+ * @class RaylibRenderBackend
+ * @brief Forwards every draw command to raylib / rlgl.
+ *
+ * Batched geometry is streamed through rlgl in blocks that stay below the
+ * default render batch size, so large streams never force a mid-block flush.
+ *
+ * Draws sampling the font atlas registered with SetTextShader() run through the
+ * text shader. The shader is switched lazily, only when a draw changes between
+ * font and non-font textures, so consecutive text draws share one batch.
+ */
+class RaylibRenderBackend : public IRenderBackend {
+public:
+    int GetScreenWidth() const override;
+    int GetScreenHeight() const override;
+    int GetFPS() const override;
+
+    void BeginTextureMode(RenderTexture2D target) override;
+    void EndTextureMode() override;
+    void ClearBackground(Color color) override;
+    void PushMatrix() override;
+    void Translate(float x, float y) override;
+    void PopMatrix() override;
+
+    void DrawTriangles(const ColorVertex* vertices, int vertexCount) override;
+    void DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) override;
+
+    void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) override;
+    void DrawRectangle(int posX, int posY, int width, int height, Color color) override;
+    void DrawRectangleLines(int posX, int posY, int width, int height, Color color) override;
+    void DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) override;
+    void DrawCircleV(Vector2 center, float radius, Color color) override;
+
+    Vector2 MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const override;
+    void DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) override;
+
+    /**
+     * @brief Draws every later use of fontAtlas through shader (e.g. SDF text).
+     * Pass a zero-id texture to disable. Neither resource is owned.
+     */
+    void SetTextShader(Texture2D fontAtlas, Shader shader);
+
+private:
+    /** @brief Enables the text shader for font atlas draws and disables it for everything else. */
+    void SelectShader(unsigned int textureId);
+
+    /** @brief Returns to the default shader; texture mode changes start from a known state. */
+    void ResetShader();
+
+    unsigned int m_TextAtlasId{ 0 };
+    Shader m_TextShader{};
+    bool m_TextShaderActive{ false };
+
+    // Keep each rlBegin/rlEnd block well below rlgl's default batch size
+    static constexpr int MAX_TRIANGLES_PER_BLOCK = 2048;
+    static constexpr int MAX_QUADS_PER_BLOCK = 1024;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Rendering/NullRenderBackend.h"
+
+/**
+ * @struct RenderStats
+ * @brief Counters collected by RecordingRenderBackend.
+ *
+ * A draw call is a run of consecutive primitives sharing the same primitive
+ * mode and texture, which is what rlgl turns into one glDrawArrays. A flush is
+ * a point where rlgl has to upload and draw its whole batch.
+ */
+struct RenderStats {
+    int drawCalls = 0;
+    int vertices = 0;
+    int textureChanges = 0;
+    int modeChanges = 0;
+    int flushes = 0;
+
+    /** @brief Every change of pipeline state (texture or primitive mode). */
+    int GetStateChanges() const { return textureChanges + modeChanges; }
+};
+
+/**
+ * @class RecordingRenderBackend
+ * @brief Headless backend that draws nothing but models rlgl's batching.
+ *
+ * Each command is translated into the primitive mode, texture and vertex count
+ * raylib would emit for it (e.g. DrawCircleV is 18 quads, DrawLineEx two
+ * triangles, DrawTextEx one quad per visible glyph on the font texture), and
+ * the resulting draw calls, state changes and flushes are counted.
+ */
+class RecordingRenderBackend : public NullRenderBackend {
+public:
+    RecordingRenderBackend(int screenWidth, int screenHeight);
+
+    /** @brief Clears the counters and the modeled batch state (call once per frame). */
+    void Reset();
+
+    const RenderStats& GetStats() const;
+
+    void BeginTextureMode(RenderTexture2D target) override;
+    void EndTextureMode() override;
+
+    void DrawTriangles(const ColorVertex* vertices, int vertexCount) override;
+    void DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) override;
+
+    void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) override;
+    void DrawRectangle(int posX, int posY, int width, int height, Color color) override;
+    void DrawRectangleLines(int posX, int posY, int width, int height, Color color) override;
+    void DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) override;
+    void DrawCircleV(Vector2 center, float radius, Color color) override;
+
+    void DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) override;
+
+private:
+    enum class PrimitiveMode { None, Lines, Triangles, Quads };
+
+    /** @brief Accounts one primitive submission, starting a new draw call when state changes. */
+    void Record(PrimitiveMode mode, unsigned int textureId, int vertexCount);
+    void Flush();
+
+    RenderStats m_Stats;
+    PrimitiveMode m_CurrentMode{ PrimitiveMode::None };
+    unsigned int m_CurrentTexture{ 0 };
+    int m_BatchVertices{ 0 };
+    int m_BatchDrawCalls{ 0 };
+
+    // rlgl defaults (RL_DEFAULT_BATCH_BUFFER_ELEMENTS * 4, RL_DEFAULT_BATCH_DRAWCALLS)
+    static constexpr int BATCH_VERTEX_CAPACITY = 8192 * 4;
+    static constexpr int BATCH_DRAW_CALL_CAPACITY = 256;
+
+    // Vertex counts of the raylib shape functions (raylib 5.5, quads draw mode)
+    static constexpr int RECTANGLE_VERTICES = 4;
+    static constexpr int RECTANGLE_LINES_VERTICES = 8;
+    static constexpr int LINE_EX_VERTICES = 6;
+    static constexpr int CIRCLE_VERTICES = 72;
+};
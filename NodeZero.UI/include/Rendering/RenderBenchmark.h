@@ -0,0 +1,35 @@
+#pragma once
+
+/**
+ * @class RenderBenchmark
+ * @brief Headless measurement of the gameplay render preparation.
+ *
+ * Runs the real Game simulation and GameplayScreen draw code against a
+ * RecordingRenderBackend, without opening a window or creating a GL context.
+ * Prints the CPU time spent preparing each frame together with the modeled
+ * draw calls, vertices, state changes and batch flushes. Intended for CI boxes
+ * without a display (`NodeZero --render-bench [frames]`).
+ */
+class RenderBenchmark {
+public:
+    /**
+     * @brief Simulates and renders the given number of frames, then prints a report.
+     * @return Process exit code (0 on success).
+     */
+    static int Run(int frames);
+
+private:
+    static constexpr int SCREEN_WIDTH = 1920;
+    static constexpr int SCREEN_HEIGHT = 1080;
+    static constexpr float FRAME_DELTA_TIME = 1.0f / 60.0f;
+
+    static constexpr unsigned int FAKE_FONT_TEXTURE_ID = 2;
+    static constexpr unsigned int FAKE_GLOW_TEXTURE_ID = 3;
+    static constexpr unsigned int FAKE_NODE_LAYER_TEXTURE_ID = 4;
+    static constexpr unsigned int FAKE_PARTICLE_TEXTURE_ID = 5;
+
+    // Fake monospace glyph table (printable ASCII) so text takes the real layout path
+    static constexpr int FAKE_FONT_BASE_SIZE = 32;
+    static constexpr int FAKE_FONT_FIRST_CHAR = 32;
+    static constexpr int FAKE_FONT_GLYPH_COUNT = 95;
+};
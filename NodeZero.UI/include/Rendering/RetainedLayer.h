@@ -0,0 +1,55 @@
+#pragma once
+
+#include "raylib.h"
+
+/**
+ * @class RetainedLayer
+ * @brief Screen-sized render texture that keeps a UI layer between frames.
+ *
+ * Content is rendered into the layer only when it changes (Begin/End, or
+ * BeginRegion/EndRegion to repaint a single area) and composited with one
+ * textured quad every frame. Redraws must happen outside any other texture
+ * mode, i.e. from a screen's RenderOffscreen() hook.
+ *
+ * The layer stores premultiplied alpha: color is blended as usual but alpha
+ * accumulates coverage (ONE, ONE_MINUS_SRC_ALPHA), so anti-aliased text drawn
+ * onto transparent pixels composites exactly like text drawn directly.
+ */
+class RetainedLayer {
+public:
+    RetainedLayer() = default;
+    ~RetainedLayer();
+
+    RetainedLayer(const RetainedLayer&) = delete;
+    RetainedLayer& operator=(const RetainedLayer&) = delete;
+
+    /**
+     * @brief Starts a full repaint: binds the layer and clears it to transparent.
+     * (Re)allocates the texture if it does not match the current screen size.
+     */
+    void Begin();
+
+    /** @brief Starts repainting one area; everything outside it is left untouched. */
+    void BeginRegion(Rectangle region);
+
+    /** @brief Ends Begin() or BeginRegion(). */
+    void End();
+
+    /** @brief Composites the layer over the current target at the origin. */
+    void Draw() const;
+
+    /** @brief True once the layer holds content for the current screen size. */
+    bool IsValid() const;
+
+    /** @brief Forces the next repaint to be a full one. */
+    void Invalidate();
+
+    void Unload();
+
+private:
+    void BeginPremultiplied();
+
+    RenderTexture2D m_Target{};
+    bool m_HasContent{ false };
+    bool m_InRegion{ false };
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "raylib.h"
+
+/**
+ * @class SdfFont
+ * @brief Signed-distance-field font atlas, baked once from a TTF and cached on disk.
+ *
+ * Each atlas texel stores the distance to the glyph outline instead of its coverage,
+ * so one small atlas drawn through the SDF text shader stays sharp at every size the
+ * HUD and menus scale text to. Baking the distance fields is slow, so the atlas and
+ * glyph metrics are written to the cache directory and reused until the source font
+ * changes (size or content hash) or the cache format version is bumped.
+ *
+ * Loading is split in two so the file work can run off the main thread: LoadData()
+ * reads or bakes the atlas image and metrics, Upload() turns the image into the
+ * font texture on the thread that owns the GL context.
+ */
+class SdfFont {
+public:
+    /** @brief A font whose atlas is still an image in memory; texture.id is 0 until Upload(). */
+    struct Data {
+        Font font{};
+        Image atlas{};
+    };
+
+    /**
+     * @brief Reads the cached atlas, baking and caching it first if it is missing or stale.
+     * Touches no GPU state, so it is safe on any thread.
+     * @param fontData TTF/OTF file contents to bake from (e.g. an embedded asset).
+     * @param fontDataSize Size of fontData in bytes.
+     * @param cacheDirectory Writable directory, ending with a path separator.
+     * @return The font data, with a null atlas if the source font could not be parsed.
+     */
+    static Data LoadData(const unsigned char* fontData, int fontDataSize, const std::string& cacheDirectory);
+
+    /**
+     * @brief Uploads the atlas as the font texture and frees the image. Call after the window
+     * exists, on its thread. Unload the result with UnloadFont().
+     * @return The SDF font, or a Font with texture.id == 0 if there was no atlas.
+     */
+    static Font Upload(Data& data);
+
+    /** @brief Size the glyphs are rasterized at; text is scaled from this like a normal font. */
+    static constexpr int BASE_SIZE = 48;
+
+private:
+    /** @brief Identifies the source font and bake settings a cache was produced from. */
+    struct CacheHeader {
+        uint32_t magic;
+        int32_t version;
+        int32_t baseSize;
+        int32_t glyphPadding;
+        int32_t glyphCount;
+        int64_t sourceSize;
+        uint64_t sourceHash; // FNV-1a of the font file; embedded fonts have no modification time
+    };
+
+    static CacheHeader MakeHeader(const unsigned char* fontData, int fontDataSize);
+    static bool LoadFromCache(const std::string& atlasPath, const std::string& metricsPath, const CacheHeader& expected, Data& data);
+    static Data Bake(const unsigned char* fontData, int fontDataSize, const std::string& atlasPath, const std::string& metricsPath, const CacheHeader& header);
+    static void WriteMetrics(const std::string& metricsPath, const CacheHeader& header, const Font& font);
+
+    static constexpr uint32_t CACHE_MAGIC = 0x4653445A; // "ZDSF"
+    static constexpr int CACHE_VERSION = 2;
+    static constexpr int GLYPH_COUNT = 95;   // Printable ASCII, same set as LoadFont()
+    static constexpr int GLYPH_PADDING = 2;  // Empty border between atlas glyphs (no filtering bleed)
+    static constexpr int PACK_SKYLINE = 1;   // GenImageFontAtlas packing method
+    static constexpr const char* ATLAS_FILE_NAME = "font_sdf.png";
+    static constexpr const char* METRICS_FILE_NAME = "font_sdf.bin";
+};
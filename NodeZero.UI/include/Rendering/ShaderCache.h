@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "raylib.h"
+
+/**
+ * @class ShaderCache
+ * @brief Keeps linked shader programs as driver binaries in the user data directory.
+ *
+ * Compiling GLSL costs noticeable time on some drivers, and each shader variant pays it
+ * again. The first load of a shader compiles it from source as usual and saves the linked
+ * program (glGetProgramBinary) next to the save file; later launches give that binary back
+ * to the driver (glProgramBinary) instead of compiling. A binary is only used if it was
+ * made from the same source by the same driver (GL vendor, renderer and version strings),
+ * and one the driver rejects anyway is recompiled from source and replaced.
+ *
+ * rlgl does not wrap the program binary calls, so they are loaded through GLFW (built
+ * into raylib on desktop). Without them (GL below 4.1 and no ARB_get_program_binary, or
+ * a driver that offers no binary formats) every load is a plain source compile.
+ */
+class ShaderCache {
+public:
+    /**
+     * @brief Looks up the GL entry points and identifies the driver. Call after the window exists.
+     * @param cacheDirectory Writable directory, ending with a path separator.
+     */
+    explicit ShaderCache(const std::string& cacheDirectory);
+    ~ShaderCache();
+
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+
+    /**
+     * @brief Drop-in for LoadShaderFromMemory(): the cached program when it is valid, else a
+     * source compile whose result is cached. Unload the result with UnloadShader().
+     * @param vsCode Vertex shader source, or nullptr for raylib's default vertex shader.
+     */
+    Shader Load(const char* vsCode, const char* fsCode);
+
+    /** @brief Whether the driver supports program binaries; if not, Load() always compiles. */
+    bool IsSupported() const { return m_Supported; }
+
+private:
+    struct GlFunctions;
+
+    /** @brief Identifies the source and driver a binary was produced from, and the binary itself. */
+    struct CacheHeader {
+        uint32_t magic;
+        int32_t version;
+        uint64_t sourceHash;
+        uint64_t driverHash;
+        uint32_t binaryFormat;
+        int32_t binaryLength;
+    };
+
+    /** @brief Creates a program from the cached binary; 0 if it is missing, stale or rejected. */
+    unsigned int LoadBinary(const std::string& path, const CacheHeader& expected);
+
+    /** @brief Writes the linked program's binary; a failure only costs a compile next launch. */
+    void SaveBinary(const std::string& path, CacheHeader header, unsigned int program);
+
+    /** @brief Wraps a linked program with the attribute and uniform locations LoadShaderFromMemory() sets. */
+    static Shader MakeShader(unsigned int program);
+
+    std::string m_Directory;
+    std::unique_ptr<GlFunctions> m_Gl;
+    uint64_t m_DriverHash{ 0 };
+    bool m_Supported{ false };
+
+    static constexpr uint32_t CACHE_MAGIC = 0x4853445A; // "ZDSH"
+    static constexpr int CACHE_VERSION = 1;
+    static constexpr const char* FILE_PREFIX = "shader_";
+    static constexpr const char* FILE_EXTENSION = ".bin";
+};
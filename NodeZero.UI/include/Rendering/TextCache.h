@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Rendering/IRenderBackend.h"
+#include "raylib.h"
+
+/**
+ * @class TextRun
+ * @brief One string laid out once: measured extents plus a ready-to-draw glyph quad list.
+ *
+ * Build() does the work DrawTextEx repeats every frame (UTF-8 decoding, glyph lookup,
+ * metrics, UVs). Draw() then hands the stored quads to the backend as a single
+ * textured quad list; the quads are only moved or recolored when the position or
+ * tint differs from the previous draw.
+ */
+class TextRun {
+public:
+    /** @brief Lays out the text. Same layout rules as raylib's DrawTextEx (newlines included). */
+    void Build(const char* text, Font font, float fontSize, float spacing);
+
+    /** @brief Draws the prebuilt quads with their top-left corner at `position`. */
+    void Draw(IRenderBackend& backend, Vector2 position, Color tint);
+
+    /** @brief True if the run was built from this text with the same font and size. */
+    bool Matches(const char* text, Font font, float fontSize, float spacing) const;
+
+    /** @brief Measured extents, as MeasureTextEx reports them. */
+    Vector2 GetSize() const;
+
+    const std::string& GetText() const;
+
+private:
+    static bool SameFont(Font left, Font right);
+
+    std::string m_Text;
+    Font m_Font{};
+    float m_FontSize{ 0.0f };
+    float m_Spacing{ 0.0f };
+    Vector2 m_Size{ 0.0f, 0.0f };
+
+    // Quads in screen space for the last drawn position and tint
+    std::vector<TextureVertex> m_Quads;
+    Vector2 m_Position{ 0.0f, 0.0f };
+    Color m_Tint{ 255, 255, 255, 255 };
+
+    // Fonts without glyph data (default font, headless runs) are drawn via DrawTextEx
+    bool m_UseFallback{ false };
+};
+
+/**
+ * @class TextCache
+ * @brief TextRuns keyed on (string, font, size, spacing), built on first use.
+ *
+ * Meant for text that rarely changes (labels, button captions, stat lines). Text
+ * that changes every few frames should own a TextRun and rebuild it when its value
+ * changes instead of filling the cache with one-off strings. The cache is emptied
+ * when it grows past MAX_RUNS, which bounds memory if a caller misuses it.
+ */
+class TextCache {
+public:
+    /** @brief Returns the cached run for this text, laying it out on a miss. */
+    TextRun& Get(const char* text, Font font, float fontSize, float spacing = 1.0f);
+
+    /** @brief Drops every run (e.g. after the font was reloaded). */
+    void Clear();
+
+    size_t GetSize() const;
+
+private:
+    struct Key {
+        std::string text;
+        unsigned int fontTexture;
+        float fontSize;
+        float spacing;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    static constexpr size_t MAX_RUNS = 256;
+
+    std::unordered_map<Key, TextRun, KeyHash> m_Runs;
+    Key m_Lookup; // Reused so a hit does not allocate a new key string
+};
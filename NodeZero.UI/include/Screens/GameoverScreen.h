@@ -24,6 +24,12 @@ public:
      */
     void Update(float deltaTime);
 
+    /**
+     * @brief Refreshes the score label and repaints changed widgets into the menu's
+     * cached layer. Called before the frame's main target is bound.
+     */
+    void RenderOffscreen();
+
     /**
      * @brief Draws the "Game Over" title, final score, and menu buttons.
      */
@@ -33,6 +39,8 @@ private:
     IGame& m_Game;
     std::function<void(GameScreen)> m_StateChangeCallback;
     std::unique_ptr<Menu> m_Menu;
+    Label* m_PointsLabel; // Owned by m_Menu
+    int m_ShownPoints;
     Font m_Font;
 
     // --- Constants (UI Layout) ---
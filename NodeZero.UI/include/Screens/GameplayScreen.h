@@ -1,16 +1,22 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "Enums/GameScreen.h"
-#include "Events/IObserver.h"
-#include "IGame.h"
+#include "Events/GameEvents.h"
+#include "GeometryBatch.h"
+#include "ParticleSystem.h"
+#include "Rendering/DrawCommandBuffer.h"
+#include "Rendering/QualityGovernor.h"
+#include "Simulation/GameSnapshot.h"
+#include "SpriteBatch.h"
 #include "raylib.h"
 
 // Forward declaration
-class INode;
+class SimulationThread;
 
 /**
  * @struct PickupCollectEffect
@@ -23,49 +29,71 @@ struct PickupCollectEffect {
     float size;
 };
 
-/**
- * @struct DamageParticle
- * @brief Tracks the state of a single particle spawned upon enemy damage (e.g., blood/gore).
- */
-struct DamageParticle {
-    Vector2 position;
-    Vector2 velocity;
-    float lifetime;
-    float maxLifetime;
-    float size;
-    Color color;
-};
-
 /**
  * @class GameplayScreen
  * @brief The main active game screen where rendering and primary update logic occurs.
  *
- * Implements the IObserver interface to react to game events (e.g., NodeDamaged)
- * to trigger visual effects (screen shake, particles).
+ * The game itself runs on the SimulationThread; this screen only reads the snapshots
+ * it publishes and hands it the mouse position. Game events arrive with the snapshots
+ * and trigger the visual effects (screen shake, particles, pickup trails).
  */
-class GameplayScreen : public IObserver, public std::enable_shared_from_this<GameplayScreen> {
+class GameplayScreen {
 public:
-    GameplayScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font);
+    GameplayScreen(SimulationThread& simulation, std::function<void(GameScreen)> stateChangeCallback, Font font,
+        Texture2D glowTexture, Texture2D particleTexture, RenderTexture2D nodeLayer);
 
     void Update(float deltaTime);
     void Draw();
 
+    /**
+     * @brief Takes the newest snapshot, starts the effects for its events and advances running effects.
+     * Update() calls this; headless runs that step the simulation themselves call it directly.
+     */
+    void UpdateEffects(float deltaTime);
+
+    /**
+     * @brief Renders the node layer into its offscreen texture.
+     * Must be called once per frame before Draw() and outside any other texture mode.
+     */
+    void RenderOffscreen();
+
     /** @brief Clears all running visual effects, typically when transitioning out of the screen. */
     void ClearEffects();
 
-    void Update(const std::shared_ptr<IEvent>& event) override;
+    /**
+     * @brief Reads the effect quality tier from this governor each frame and shows it in the debug overlay.
+     * @param governor Not owned; nullptr keeps every effect on.
+     */
+    void SetQualityGovernor(const QualityGovernor* governor);
 
 private:
-    IGame& m_Game;
+    SimulationThread& m_Simulation;
     std::function<void(GameScreen)> m_StateChangeCallback;
     std::vector<PickupCollectEffect> m_PickupEffects;
-    std::vector<DamageParticle> m_DamageParticles;
     Font m_Font;
 
+    /** @brief Reused triangle stream; each node pass is submitted as one draw call. */
+    GeometryBatch m_NodeBatch;
+
+    /** @brief Tinted glow sprites for the bloom pass (one quad per glow, one draw call). */
+    SpriteBatch m_GlowBatch;
+
+    /** @brief Damage particles (SoA ring buffer) and the disc sprites they are drawn with. */
+    ParticleSystem m_Particles{ PARTICLE_CAPACITY, PARTICLE_GRAVITY };
+    SpriteBatch m_ParticleBatch;
+
+    /** @brief Records Draw() and replays it with the fewest batch breaks. */
+    DrawCommandBuffer m_Commands;
+
+    /** @brief All nodes, drawn once per frame; blitted for both the reflection and the main pass. */
+    RenderTexture2D m_NodeLayer;
+
+    const QualityGovernor* m_Governor{ nullptr };
+
     // Constants (Refactor: Visual/Physics Tuning)
 
     // Limits
-    static constexpr size_t MAX_PARTICLES = 500;
+    static constexpr int PARTICLE_CAPACITY = 32768; // Oldest particles are recycled beyond this
     static constexpr size_t MAX_PICKUP_EFFECTS = 100;
 
     // Timings
@@ -84,9 +112,16 @@ private:
     static constexpr float PARTICLE_GRAVITY = 200.0f;
     static constexpr float PARTICLE_BASE_SIZE_SCALING = 3.0f;
     static constexpr int PARTICLE_COLOR_VARIANCE = 20;
+    static constexpr int CAPPED_PARTICLE_COUNT = 2;      // Per hit, from QualityTier::CappedParticles
+    static constexpr int CAPPED_PARTICLE_LIMIT = 1024;   // No new bursts above this many live particles
 
     // Drawing/UI
     static constexpr float REFLECTION_OFFSET_RATIO = 0.02f;
+    static constexpr unsigned char REFLECTION_ALPHA = 5;
+    static constexpr unsigned char BLOOM_ALPHA = 40;
+    static constexpr float NODE_BLOOM_RADIUS_RATIO = 2.0f;
+    static constexpr float REDUCED_BLOOM_RADIUS_RATIO = 1.15f; // About a third of the full glow's area
+    static constexpr float ZONE_BLOOM_RADIUS_RATIO = 0.8f;
     static constexpr float CORNER_LENGTH_RATIO = 0.02f;
     static constexpr float CORNER_THICKNESS_RATIO = 0.003f;
     static constexpr float CENTER_SQUARE_SIZE_RATIO = 0.008f;
@@ -95,15 +130,35 @@ private:
     float m_ShakeDuration{ 0.0f };
     float m_ShakeTimer{ 0.0f };
     Vector2 m_ShakeOffset{ 0.0f, 0.0f };
+    uint32_t m_ShakeRandomState{ 0x2545F491u }; // xorshift32, so the render thread never shares rand() with the simulation
 
+    void HandleEvent(const GameEvent& event);
     void TriggerShake(float intensity, float duration);
     void UpdateShake(float deltaTime);
+
+    /** @brief Next shake jitter in [-1, 1), from the screen's own xorshift32 state. */
+    float NextShakeRandom();
     void SpawnDamageParticles(Vector2 position, Color baseColor, int count);
-    void UpdateParticles(float deltaTime);
 
-    /** @brief Draws the offset shadows, contributing to the neon/reflection effect. */
-    void DrawReflections(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset);
+    /** @brief Current effect tier (Full without a governor). */
+    QualityTier GetQualityTier() const;
+
+    /** @brief Bounds test against the screen rect; entities failing it are skipped by every draw pass. */
+    bool IsVisible(float x, float y, float radius) const;
+
+    /** @brief Batches every visible node and submits the pass in one draw call. */
+    void DrawNodes(Span<const NodeRenderData> nodes);
+
+    /** @brief Blits the node layer at an offset with the given tint. */
+    void DrawNodeLayer(float offset, Color tint);
+
+    /** @brief Draws the damage zone's offset shadow (nodes get theirs from the node layer). */
+    void DrawZoneReflection(Vector2 mousePos, float damageZoneSize, float reflectionOffset);
 
-    /** @brief Draws the glowing circles behind entities, contributing to the neon/bloom effect. */
-    void DrawBloom(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize);
+    /**
+     * @brief Draws the glowing circles behind entities, contributing to the neon/bloom effect.
+     * Each glow is a single tinted quad of the shared glow texture; the zone glow is
+     * recorded anchored, around mousePos.
+     */
+    void DrawBloom(Span<const NodeRenderData> nodes, Vector2 mousePos, float damageZoneSize);
 };
\ No newline at end of file
@@ -19,12 +19,17 @@ class LevelCompletedScreen {
 public:
     LevelCompletedScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font);
     void Update(float deltaTime);
+
+    /** @brief Refreshes the points label and repaints changed widgets (before the main target is bound). */
+    void RenderOffscreen();
     void Draw();
 
 private:
     IGame& m_Game;
     std::function<void(GameScreen)> m_StateChangeCallback;
     std::unique_ptr<Menu> m_Menu;
+    Label* m_PointsLabel; // Owned by m_Menu
+    int m_ShownPoints;
     Font m_Font;
 
     // Constants (UI Layout)
@@ -19,6 +19,9 @@ public:
     MainScreen(std::function<void(GameScreen)> stateChangeCallback, Font font);
 
     void Update(float deltaTime);
+
+    /** @brief Repaints changed widgets into the menu's cached layer (before the main target is bound). */
+    void RenderOffscreen();
     void Draw();
 
 private:
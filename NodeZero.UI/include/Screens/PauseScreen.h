@@ -5,6 +5,8 @@
 
 #include "Enums/GameScreen.h"
 #include "IGame.h"
+#include "Rendering/DynamicResolution.h"
+#include "Widgets/Button.h"
 #include "Widgets/Menu.h"
 #include "raylib.h"
 
@@ -12,20 +14,34 @@
  * @class PauseScreen
  * @brief Handles the screen displayed when the game is paused.
  *
- * It draws a semi-transparent overlay and provides options to resume the game
- * or terminate the current session.
+ * It draws a semi-transparent overlay and provides options to resume the game,
+ * pick the render quality or terminate the current session.
  */
 class PauseScreen {
 public:
-    PauseScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font);
+    PauseScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font, DynamicResolution& resolution);
 
     void Update(float deltaTime);
+
+    /** @brief Repaints changed widgets into the menu's cached layer (before the main target is bound). */
+    void RenderOffscreen();
     void Draw();
 
 private:
+    /** @brief Advances to the next quality preset and relabels the quality button. */
+    void CycleQuality();
+
     std::unique_ptr<Menu> m_Menu;
     IGame& m_Game;
     std::function<void(GameScreen)> m_StateChangeCallback;
+    DynamicResolution& m_Resolution;
+    Button* m_QualityButton; // Owned by m_Menu
+    int m_QualityIndex;
+
+    // Quality presets cycled by the quality button (render scale, or automatic)
+    static constexpr int QUALITY_PRESET_COUNT = 4;
+    static constexpr float QUALITY_PRESETS[QUALITY_PRESET_COUNT] = { DynamicResolution::AUTOMATIC, 1.0f, 0.75f, 0.5f };
+    static constexpr const char* QUALITY_LABELS[QUALITY_PRESET_COUNT] = { "Quality: Auto", "Quality: 100%", "Quality: 75%", "Quality: 50%" };
 
     // Constants (UI Layout)
     static constexpr float TITLE_TEXT_HEIGHT_RATIO = 0.06f;
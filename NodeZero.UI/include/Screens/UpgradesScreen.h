@@ -4,6 +4,8 @@
 
 #include "Enums/GameScreen.h"
 #include "IGame.h"
+#include "Rendering/RetainedLayer.h"
+#include "Rendering/TextCache.h"
 #include "raylib.h"
 
 /**
@@ -13,15 +15,39 @@
  * Draws current statistics and provides interactive buttons for purchasing
  * persistent upgrades (Health, Regen, Damage, Zone Size). Handles mouse click
  * debouncing and purchase logic.
+ *
+ * The screen is painted into a RetainedLayer and only repainted when the
+ * hovered button changes, a purchase succeeds or Invalidate() is called;
+ * other frames just composite the cached layer.
  */
 class UpgradesScreen {
 public:
     UpgradesScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font);
 
     void Update(float deltaTime);
+
+    /** @brief Repaints the cached layer if needed (before the frame's main target is bound). */
+    void RenderOffscreen();
     void Draw();
 
+    /** @brief Forces a repaint, e.g. when entering the screen after points changed elsewhere. */
+    void Invalidate();
+
 private:
+    /** @brief One purchasable upgrade as shown on its button. */
+    struct UpgradeOption {
+        const char* label;
+        int cost;
+        bool isMaxed;
+    };
+
+    UpgradeOption GetOption(int index) const;
+    bool BuyOption(int index);
+    Rectangle GetButtonRect(int index) const;
+
+    /** @brief Draws the whole screen (called with the cached layer bound). */
+    void Paint();
+
     IGame& m_Game;
     std::function<void(GameScreen)> m_StateChangeCallback;
 
@@ -32,6 +58,13 @@ private:
     bool m_IsFirstFrame;
     Font m_Font;
 
+    /** @brief Laid-out text; stat lines only miss after a purchase changes their value. */
+    TextCache m_TextCache;
+
+    RetainedLayer m_Layer;
+    bool m_IsDirty;
+    int m_HoveredButton; // -1 if none
+
     // Constants (UI Layout)
     static constexpr float TITLE_TEXT_HEIGHT_RATIO = 0.05f;
     static constexpr float TITLE_Y_RATIO = 0.05f;
@@ -53,6 +86,8 @@ private:
     static constexpr float COST_TEXT_FONT_RATIO = 0.28f;
     static constexpr float BUTTON_TEXT_Y_RATIO = 0.15f;
     static constexpr float COST_TEXT_Y_RATIO = 0.55f;
+    static constexpr int UPGRADE_COUNT = 4;
+    static constexpr float DAMAGE_ZONE_MAX_SIZE = 300.0f;
 
     // Footer
     static constexpr float FOOTER_TEXT_FONT_RATIO = 0.025f;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Rendering/IRenderBackend.h"
+#include "raylib.h"
+
+/**
+ * @class SpriteBatch
+ * @brief Queues tinted, scaled copies of one texture and draws them together.
+ *
+ * Every sprite is a single textured quad, so the cost per sprite is constant
+ * regardless of its on-screen size. All quads share the batch texture and are
+ * handed to the render backend as one textured quad list.
+ */
+class SpriteBatch {
+public:
+    SpriteBatch();
+
+    /** @brief Sets the texture used by all queued sprites. */
+    void SetTexture(Texture2D texture);
+
+    /** @brief Discards all queued sprites (capacity is kept). */
+    void Clear();
+
+    /**
+     * @brief Queues the whole texture stretched over a square.
+     * @param center Center of the sprite in screen coordinates.
+     * @param halfSize Half of the square's side length.
+     * @param tint Color multiplied with the texture.
+     */
+    void AddSprite(Vector2 center, float halfSize, Color tint);
+
+    /** @brief Queues the whole texture stretched over an arbitrary rectangle. */
+    void AddSprite(Rectangle dest, Color tint);
+
+    /**
+     * @brief Bulk path: appends room for `count` sprites and returns their vertices.
+     * Fill each sprite with WriteSprite(); avoids a call and capacity check per sprite.
+     */
+    TextureVertex* AppendSprites(int count);
+
+    /** @brief Writes the four vertices of a square sprite (TL, BL, BR, TR). */
+    static void WriteSprite(TextureVertex* quad, float centerX, float centerY, float halfSize, Color tint) {
+        float left = centerX - halfSize;
+        float right = centerX + halfSize;
+        float top = centerY - halfSize;
+        float bottom = centerY + halfSize;
+
+        quad[0] = TextureVertex{ left, top, 0.0f, 0.0f, tint };
+        quad[1] = TextureVertex{ left, bottom, 0.0f, 1.0f, tint };
+        quad[2] = TextureVertex{ right, bottom, 1.0f, 1.0f, tint };
+        quad[3] = TextureVertex{ right, top, 1.0f, 0.0f, tint };
+    }
+
+    /** @brief Draws every queued sprite and clears the batch. */
+    void Submit(IRenderBackend& backend);
+
+    /** @brief Number of sprites currently queued. */
+    size_t GetSpriteCount() const;
+
+private:
+    Texture2D m_Texture{};
+    std::vector<TextureVertex> m_Vertices; // Four per sprite: TL, BL, BR, TR
+
+    static constexpr size_t INITIAL_SPRITE_CAPACITY = 1024;
+};
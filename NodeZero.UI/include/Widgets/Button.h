@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IWidget.h"
+#include "Rendering/TextCache.h"
 #include "raylib.h"
 #include <string>
 #include <functional>
@@ -9,11 +10,14 @@
  * @class Button
  * @brief An interactive UI component that triggers an action on click.
  *
- * Supports three visual states: Normal, Hovered, and Pressed.
+ * Supports three visual states: Normal, Hovered, and Pressed. The state is
+ * resolved in Update(), so the button only becomes dirty when it changes.
  */
 class Button : public IWidget
 {
 private:
+    enum class VisualState { Normal, Hovered, Pressed };
+
     float m_X;
     float m_Y;
     float m_Width;
@@ -27,6 +31,11 @@ private:
     std::function<void()> m_OnClick;
     Font m_Font;
 
+    /** @brief Caption laid out once; rebuilt only if the button height (font size) changes. */
+    TextRun m_Label;
+    VisualState m_State;
+    bool m_IsDirty;
+
 	// Refactor: No magic number, turned into constant
     static constexpr float TEXT_SIZE_RATIO = 0.4f;
 
@@ -47,6 +56,11 @@ public:
     bool IsHovered() const override;
     bool IsActive() const override;
     void SetActive(bool active) override;
+    bool IsDirty() const override;
+    Rectangle GetBounds() const override;
+
+    /** @brief Changes the label (marks the button dirty only if the text differs). */
+    void SetText(const char* text);
 
     /** @brief Sets the function to be executed when the button is clicked. */
     void SetOnClick(std::function<void()> callback);
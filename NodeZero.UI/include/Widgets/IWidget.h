@@ -8,6 +8,11 @@
  *
  * Defines the essential contract for drawing, updating state, and managing
  * activation status for any interactive or static UI component.
+ *
+ * Widgets are retained: a Menu caches what they drew and only redraws the
+ * ones reporting IsDirty(), inside their GetBounds(). A widget becomes dirty
+ * when its appearance changes (text, colors, hover/press state, activation)
+ * and clean again once Draw() has run.
  */
 class IWidget {
 public:
@@ -27,4 +32,10 @@ public:
 
     /** @brief Sets the active/enabled state of the widget. */
     virtual void SetActive(bool active) = 0;
+
+    /** @brief True if the widget looks different from its last Draw(). */
+    virtual bool IsDirty() const = 0;
+
+    /** @brief Screen area the widget draws into (cleared before it is redrawn alone). */
+    virtual Rectangle GetBounds() const = 0;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IWidget.h"
+#include "Rendering/TextCache.h"
 #include "raylib.h"
 #include <string>
 
@@ -20,6 +21,8 @@ private:
     Color m_Color;
     bool m_IsActive;
     Font m_Font;
+    bool m_IsDirty;
+    TextRun m_Run; // Glyph quads, rebuilt when the text changes
 
 public:
     /**
@@ -38,10 +41,15 @@ public:
     bool IsHovered() const override;
     bool IsActive() const override;
     void SetActive(bool active) override;
+    bool IsDirty() const override;
+    Rectangle GetBounds() const override;
 
-    /** @brief Sets the text content of the label. */
+    /** @brief Sets the text content of the label (marks it dirty only if the text differs). */
     void SetText(const char* text);
 
     /** @brief Gets the text content of the label. */
     const char* GetText() const;
+
+    /** @brief Moves the label (e.g. to re-center it after SetText). */
+    void SetPosition(float x, float y);
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "IWidget.h"
 #include "Button.h"
 #include "Label.h"
+#include "Rendering/RetainedLayer.h"
 #include <vector>
 #include <memory>
 
@@ -12,12 +13,24 @@
  *
  * Manages a collection of buttons, labels, or other widgets and forwards
  * Draw and Update calls to its children.
+ *
+ * When the owning screen calls RenderOffscreen() each frame, the children are
+ * kept in a RetainedLayer: only dirty widgets are repainted (inside their old
+ * and new bounds) and Draw() composites the layer with a single quad. Without
+ * RenderOffscreen() the menu draws its children directly, as before.
+ * Children are expected not to overlap, since a partial repaint clears the
+ * whole area of the widget being redrawn.
  */
 class Menu : public IWidget
 {
 private:
     std::vector<std::unique_ptr<IWidget>> m_Widgets;
+    std::vector<Rectangle> m_DrawnBounds; // Bounds of each widget at its last repaint
+    RetainedLayer m_Layer;
     bool m_IsActive;
+    bool m_IsDirty;
+
+    static Rectangle Union(Rectangle a, Rectangle b);
 
 public:
     Menu();
@@ -27,6 +40,14 @@ public:
     bool IsHovered() const override;
     bool IsActive() const override;
     void SetActive(bool active) override;
+    bool IsDirty() const override;
+    Rectangle GetBounds() const override;
+
+    /**
+     * @brief Repaints the dirty widgets into the cached layer.
+     * Must be called outside any texture mode (before the frame's main target is bound).
+     */
+    void RenderOffscreen();
 
     /**
      * @brief Adds a child widget to the menu container.
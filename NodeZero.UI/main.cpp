@@ -12,7 +12,11 @@
  * GameApp wrapper and enters the primary execution loop.
  */
 
+#include <cstdlib>
+#include <cstring>
+
 #include "GameApp.h"
+#include "Rendering/RenderBenchmark.h"
 
  /**
   * @brief Application entry point.
@@ -21,12 +25,32 @@
   * loads global resources (fonts, shaders), and orchestrates the high-level
   * state machine (Menu -> Game -> GameOver).
   *
+  * Passing `--render-bench [frames]` runs the headless RenderBenchmark instead
+  * (no window is opened). Passing `--latency-log` plays normally and logs the
+  * input-to-present latency of every gameplay frame to the user data directory,
+  * and prints frame pacing statistics on exit. `--present-prediction` paces frames
+  * to present on their deadline, sampling input as late as possible (combinable).
+  *
   * @return 0 upon successful execution and clean shutdown.
   */
-int main() {
+int main(int argc, char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--render-bench") == 0) {
+        int frames = (argc > 2) ? std::atoi(argv[2]) : 600;
+        return RenderBenchmark::Run(frames);
+    }
+
     // Create the application instance (RAII: Resources initialized in constructor)
     GameApp app;
 
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--latency-log") == 0) {
+            app.EnableLatencyLog();
+        }
+        else if (std::strcmp(argv[i], "--present-prediction") == 0) {
+            app.EnablePresentPrediction();
+        }
+    }
+
     // Start the game loop (Block until window closes or Quit is selected)
     app.Run();
 
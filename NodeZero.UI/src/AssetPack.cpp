@@ -0,0 +1,16 @@
+#include "AssetPack.h"
+
+#include <cstring>
+
+AssetPack::Asset AssetPack::Find(const char* path) {
+    // A handful of entries, looked up once each at startup: a linear scan is enough
+    for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+        if (std::strcmp(INDEX[i].path, path) == 0) {
+            Asset asset;
+            asset.data = BLOB + INDEX[i].offset;
+            asset.size = static_cast<int>(INDEX[i].size);
+            return asset;
+        }
+    }
+    return Asset{};
+}
@@ -0,0 +1,138 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+FramePacer::FramePacer(int targetFps)
+    : m_Period(NANOSECONDS_PER_SECOND / std::max(targetFps, 1)),
+    m_SpinMargin(INITIAL_SPIN_MARGIN) {
+    m_FrameStart = Now();
+    m_NextDeadline = m_FrameStart + m_Period;
+    m_LastStart = m_FrameStart;
+}
+
+void FramePacer::SetTargetFps(int targetFps) {
+    m_Period = NANOSECONDS_PER_SECOND / std::max(targetFps, 1);
+    m_NextDeadline = Now() + m_Period;
+    m_PredictedWork = 0;
+    m_SkipInterval = true;
+}
+
+void FramePacer::SetPresentPrediction(bool enabled) {
+    m_PredictPresent = enabled;
+}
+
+void FramePacer::SetKeepStats(bool keep) {
+    if (keep && !m_KeepStats) {
+        m_SkipInterval = true;
+    }
+    m_KeepStats = keep;
+}
+
+void FramePacer::Wait() {
+    const int64_t presented = Now();
+
+    if (m_PredictPresent) {
+        // Rise to a slow frame at once, drift back down over later fast ones
+        int64_t work = static_cast<int64_t>((presented - m_FrameStart) * WORK_SAFETY);
+        m_PredictedWork = std::max(work, m_PredictedWork - m_PredictedWork / WORK_DECAY_RATE);
+        m_PredictedWork = std::min(m_PredictedWork, m_Period);
+    }
+
+    // Too late for this deadline by more than a frame: restart the cadence from now
+    if (presented - m_NextDeadline > m_Period) {
+        m_NextDeadline = presented + m_Period;
+    }
+
+    int64_t start = m_NextDeadline - (m_PredictPresent ? m_PredictedWork : 0);
+    WaitUntil(start);
+
+    m_FrameStart = Now();
+    m_NextDeadline += m_Period;
+
+    if (m_KeepStats && !m_SkipInterval) {
+        m_Intervals.push_back(static_cast<float>(m_FrameStart - m_LastStart) / 1.0e6f);
+    }
+    m_SkipInterval = false;
+    m_LastStart = m_FrameStart;
+}
+
+void FramePacer::WaitUntil(int64_t deadline) {
+    const int64_t sleepUntil = deadline - m_SpinMargin;
+    const int64_t before = Now();
+
+    if (sleepUntil > before) {
+#if defined(__linux__)
+        timespec wake{};
+        wake.tv_sec = static_cast<time_t>(sleepUntil / NANOSECONDS_PER_SECOND);
+        wake.tv_nsec = static_cast<long>(sleepUntil % NANOSECONDS_PER_SECOND);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr) == EINTR) {
+        }
+#else
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleepUntil - before));
+#endif
+
+        // How late the OS woke us decides how much to spin next time
+        const int64_t woke = Now();
+        const int64_t target = static_cast<int64_t>((woke - sleepUntil) * SPIN_SAFETY);
+        if (target > m_SpinMargin) {
+            m_SpinMargin = target;
+        }
+        else {
+            m_SpinMargin -= (m_SpinMargin - target) / SPIN_SHRINK_RATE;
+        }
+        m_SpinMargin = std::clamp(m_SpinMargin, MIN_SPIN_MARGIN, MAX_SPIN_MARGIN);
+
+        if (m_KeepStats) {
+            m_SleepTime += woke - before;
+        }
+    }
+
+    const int64_t spinStart = Now();
+    int64_t now = spinStart;
+    while (now < deadline) {
+        now = Now();
+    }
+
+    if (m_KeepStats) {
+        m_SpinTime += now - spinStart;
+    }
+}
+
+void FramePacer::PrintSummary() const {
+    if (m_Intervals.empty()) return;
+
+    std::vector<float> intervals = m_Intervals;
+    float average = std::accumulate(intervals.begin(), intervals.end(), 0.0f) / intervals.size();
+    std::sort(intervals.begin(), intervals.end());
+    float median = intervals[intervals.size() / 2];
+    float p99 = intervals[(intervals.size() - 1) * 99 / 100];
+
+    double waited = static_cast<double>(m_SleepTime + m_SpinTime);
+    double spinShare = waited > 0.0 ? 100.0 * m_SpinTime / waited : 0.0;
+
+    std::cout << "Frame pacing over " << intervals.size() << " frames: avg " << average
+        << " ms, p50 " << median << " ms, p99 " << p99 << " ms (p99 - p50 " << p99 - median
+        << " ms), " << spinShare << "% of the wait spent spinning, spin tail "
+        << m_SpinMargin / 1000 << " us" << (m_PredictPresent ? ", present prediction on" : "") << std::endl;
+}
+
+int64_t FramePacer::Now() {
+#if defined(__linux__)
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * NANOSECONDS_PER_SECOND + now.tv_nsec;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
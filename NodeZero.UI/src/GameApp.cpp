@@ -1,14 +1,24 @@
 #include "GameApp.h"
 
 #include <algorithm>
+#include <future>
 #include <iostream>
 
+#include "AssetPack.h"
 #include "Config/GameConfig.h"
 #include "EventLogger.h"
+#include "FramePacer.h"
 #include "Game.h"
 #include "IGame.h"
 #include "InputHandler.h"
+#include "InputLatencyLog.h"
 #include "Renderer.h"
+#include "Rendering/CrtPass.h"
+#include "Rendering/DynamicResolution.h"
+#include "Rendering/QualityGovernor.h"
+#include "Rendering/ShaderCache.h"
+#include "Services/ISaveService.h"
+#include "Simulation/SimulationThread.h"
 
 // Screen Includes
 #include "Screens/GameoverScreen.h"
@@ -19,20 +29,44 @@
 #include "Screens/UpgradesScreen.h"
 
 #include "raymath.h"
+#include "rlgl.h"
+
+// CRT effects kept at QualityTier::SimpleCrt: one texture tap, vignette from the lookup texture
+static constexpr unsigned int SIMPLE_CRT_EFFECTS = CrtPass::VIGNETTE;
+
+// Milliseconds from `start` to now, for the startup report
+static long long MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
 
 GameApp::GameApp()
     : m_CurrentState(GameScreen::MainMenu),
     m_PreviousState(GameScreen::MainMenu),
     m_ShouldClose(false),
     m_ElapsedTime(0.0f),
-    m_ResolutionLoc(0),
-    m_TimeLoc(0) {
+    m_TextShader{},
+    m_OwnsFont(false),
+    m_LogLatency(false),
+    m_PredictPresent(false),
+    m_Idle(false),
+    m_StaleFrameTimes(0),
+    m_FrozenGameplay{},
+    m_GameplayFrozen(false),
+    m_StartTime(std::chrono::steady_clock::now()) {
 }
 
 GameApp::~GameApp() {
     Cleanup();
 }
 
+void GameApp::EnableLatencyLog() {
+    m_LogLatency = true;
+}
+
+void GameApp::EnablePresentPrediction() {
+    m_PredictPresent = true;
+}
+
 void GameApp::Initialize() {
     // Window Setup
     SetConfigFlags(FLAG_WINDOW_UNDECORATED);
@@ -46,50 +80,256 @@ void GameApp::Initialize() {
     SetWindowPosition(0, 0);
 
     SetExitKey(KEY_NULL); // Disable ESC to quit (we handle it manually)
-    SetTargetFPS(TARGET_FPS);
+
+    // Frames are paced by m_Pacer; raylib's own wait sleeps too coarsely for even spacing
+    SetTargetFPS(0);
+    m_Pacer = std::make_unique<FramePacer>(TARGET_FPS);
+    m_Pacer->SetPresentPrediction(m_PredictPresent);
 
     const int screenWidth = GetScreenWidth();
     const int screenHeight = GetScreenHeight();
 
-    // Resource Loading
-    m_Font = LoadFont(FONT_PATH);
+    // Stage 1, on worker threads: everything that only reads files or bakes on the CPU.
+    // The game (and its save file) comes first, the font cache lives in its data directory.
+    // Fonts and shaders are embedded in the executable, so they are used in place.
+    std::unique_ptr<IGame> game;
+    SdfFont::Data fontData;
+    auto coreLoad = std::async(std::launch::async, [&] {
+        game = std::make_unique<Game>();
+        game->Initialize(static_cast<float>(screenWidth), static_cast<float>(screenHeight));
+        AssetPack::Asset font = AssetPack::Find(FONT_ASSET);
+        fontData = SdfFont::LoadData(font.data, font.size, game->GetSaveService().GetDataDirectory());
+    });
+
+    CrtPass::Assets crtAssets;
+    auto shaderLoad = std::async(std::launch::async, [&] {
+        crtAssets = CrtPass::Prepare(AssetPack::Find(SHADER_ASSET).GetText(), screenHeight);
+    });
+
+    // The window shows something at once and stays responsive while the workers run
+    auto isReady = [](const std::future<void>& load) {
+        return load.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+    DrawLoadingFrame();
+    long long firstFrameTime = MillisecondsSince(m_StartTime);
+    while (!isReady(coreLoad) || !isReady(shaderLoad)) {
+        m_Pacer->Wait();
+        DrawLoadingFrame();
+    }
+    coreLoad.get(); // Rethrows a worker's exception here
+    shaderLoad.get();
+
+    // Stage 2, on this thread: GPU uploads and everything that holds on to the game
+    m_Game = std::move(game);
+
+    // Fixed-tick simulation thread; stays idle until the first switch to Playing
+    m_Simulation = std::make_unique<SimulationThread>(*m_Game, GameConfig::SIMULATION_TICK_RATE);
+    m_Simulation->Start();
 
-    // Logic Initialization
-    m_Game = std::make_unique<Game>();
-    m_Game->Initialize(static_cast<float>(screenWidth), static_cast<float>(screenHeight));
+    // Resource Loading; compiled shaders are cached next to the save file
+    m_ShaderCache = std::make_unique<ShaderCache>(m_Game->GetSaveService().GetDataDirectory());
+    LoadTextFont(fontData);
+    m_GlowTexture = Renderer::GenerateGlowTexture(GLOW_TEXTURE_SIZE);
+    m_ParticleTexture = Renderer::GenerateDiscTexture(PARTICLE_TEXTURE_SIZE);
 
     // Observer Attachment
     auto eventLogger = std::make_shared<EventLogger>();
     m_Game->Attach(eventLogger);
 
-    // Screen Setup
-    auto stateChangeCallback = [this](GameScreen newState) { ChangeState(newState); };
+    // Offscreen node layer (transparent background, composited by GameplayScreen)
+    m_NodeLayer = LoadRenderTexture(screenWidth, screenHeight);
+    SetTextureWrap(m_NodeLayer.texture, TEXTURE_WRAP_CLAMP);
+
+    // Effect tiers, then the scene render scale, follow frame times against TARGET_FPS
+    // (capped at the monitor's refresh rate, which frames cannot usefully beat)
+    int refreshRate = GetMonitorRefreshRate(monitor);
+    int budgetFps = std::min(refreshRate > 0 ? refreshRate : FALLBACK_REFRESH_RATE, TARGET_FPS);
+    float frameBudget = 1.0f / static_cast<float>(budgetFps);
+    m_Governor = std::make_unique<QualityGovernor>(frameBudget);
+    m_Resolution = std::make_unique<DynamicResolution>(frameBudget);
 
-    m_MainScreen = std::make_unique<MainScreen>(stateChangeCallback, m_Font);
-    m_GameplayScreen = std::make_shared<GameplayScreen>(*m_Game, stateChangeCallback, m_Font);
-    m_PauseScreen = std::make_unique<PauseScreen>(*m_Game, stateChangeCallback, m_Font);
-    m_UpgradesScreen = std::make_unique<UpgradesScreen>(*m_Game, stateChangeCallback, m_Font);
-    m_LevelCompletedScreen = std::make_unique<LevelCompletedScreen>(*m_Game, stateChangeCallback, m_Font);
-    m_GameoverScreen = std::make_unique<GameoverScreen>(*m_Game, stateChangeCallback, m_Font);
+    // Screen Setup; the other menus are built by their getters when first shown
+    m_StateChangeCallback = [this](GameScreen newState) { ChangeState(newState); };
 
-    // Gameplay Screen needs to listen to events (shake, particles)
-    m_Game->Attach(m_GameplayScreen);
+    m_MainScreen = std::make_unique<MainScreen>(m_StateChangeCallback, m_Font);
+    m_GameplayScreen = std::make_shared<GameplayScreen>(*m_Simulation, m_StateChangeCallback, m_Font, m_GlowTexture, m_ParticleTexture, m_NodeLayer);
 
-    // Shader Setup (Post-Processing)
-    m_RenderTarget = LoadRenderTexture(screenWidth, screenHeight);
+    // Game events (shake, particles) reach the gameplay screen with the simulation snapshots
+    m_GameplayScreen->SetQualityGovernor(m_Governor.get());
+
+    // Post-Processing Setup; the scene target is (re)allocated by UpdateRenderScale()
+    m_RenderTarget = RenderTexture2D{};
+
+    m_CrtPass = std::make_unique<CrtPass>();
+    m_CrtPass->SetShaderCache(m_ShaderCache.get());
+    m_CrtPass->Load(crtAssets, screenWidth);
+    m_CrtPass->Precompile(SIMPLE_CRT_EFFECTS); // The governor's lowest tier must not stall on a compile
+
+    if (m_LogLatency) {
+        m_LatencyLog = std::make_unique<InputLatencyLog>();
+        m_LatencyLog->Open(m_Game->GetSaveService().GetDataDirectory() + LATENCY_LOG_FILE_NAME);
+    }
+
+    // The app starts in the main menu
+    SetIdle(true);
+
+    std::cout << "Startup: first frame after " << firstFrameTime << " ms, main menu ready after "
+        << MillisecondsSince(m_StartTime) << " ms" << std::endl;
+}
+
+void GameApp::DrawLoadingFrame() {
+    int textWidth = MeasureText(LOADING_TEXT, LOADING_FONT_SIZE);
+
+    BeginDrawing();
+    ClearBackground(BLACK);
+    DrawText(LOADING_TEXT, (GetScreenWidth() - textWidth) / 2, (GetScreenHeight() - LOADING_FONT_SIZE) / 2, LOADING_FONT_SIZE, RAYWHITE);
+    EndDrawing();
+}
+
+void GameApp::LoadTextFont(SdfFont::Data& fontData) {
+    m_Font = SdfFont::Upload(fontData);
+
+    if (m_Font.texture.id == 0) {
+        // Font file missing: raylib's built-in bitmap font, drawn without the SDF shader
+        std::cerr << "GameApp: could not load " << FONT_ASSET << ", using the default font" << std::endl;
+        m_Font = GetFontDefault();
+        m_OwnsFont = false;
+        return;
+    }
+
+    m_OwnsFont = true;
+    m_TextShader = m_ShaderCache->Load(nullptr, AssetPack::Find(TEXT_SHADER_ASSET).GetText());
+    Renderer::SetTextShader(m_Font, m_TextShader);
+}
+
+void GameApp::UpdateQuality(bool gameplayVisible) {
+    float frameTime = GetFrameTime();
+
+    // Degrade effects first and the render scale last; recover in the opposite order.
+    // The governor only judges frames that actually draw the gameplay effects.
+    bool atFullScale = !m_Resolution->IsAutomatic() || m_Resolution->GetScale() >= 1.0f;
+    if (gameplayVisible) {
+        m_Governor->Update(frameTime, atFullScale);
+    }
+    if (m_Governor->IsLowestTier() || !atFullScale) {
+        m_Resolution->Update(frameTime);
+    }
+
+    // Each effect set is its own shader variant; disabled effects are compiled out
+    m_CrtPass->SetEffects(m_Governor->GetTier() >= QualityTier::SimpleCrt ? SIMPLE_CRT_EFFECTS : CrtPass::ALL_EFFECTS);
+}
+
+void GameApp::UpdateRenderScale() {
+    const int screenWidth = GetScreenWidth();
+    const int screenHeight = GetScreenHeight();
+    int width = std::max(1, static_cast<int>(screenWidth * m_Resolution->GetScale()));
+    int height = std::max(1, static_cast<int>(screenHeight * m_Resolution->GetScale()));
+
+    if (m_RenderTarget.id != 0 && m_RenderTarget.texture.width == width && m_RenderTarget.texture.height == height) {
+        return;
+    }
+
+    if (m_RenderTarget.id != 0) {
+        UnloadRenderTexture(m_RenderTarget);
+    }
+    m_RenderTarget = LoadRenderTexture(width, height);
     SetTextureWrap(m_RenderTarget.texture, TEXTURE_WRAP_CLAMP);
+    SetTextureFilter(m_RenderTarget.texture, TEXTURE_FILTER_BILINEAR); // Smooth upscale in the CRT pass
+}
+
+void GameApp::SetIdle(bool idle) {
+    if (idle == m_Idle) {
+        return;
+    }
+    m_Idle = idle;
+
+    if (idle) {
+        EnableEventWaiting();
+        m_Pacer->SetTargetFps(IDLE_FPS);
+    }
+    else {
+        DisableEventWaiting();
+        m_Pacer->SetTargetFps(TARGET_FPS);
+        m_StaleFrameTimes = STALE_FRAME_TIMES;
+    }
+
+    // Pacing statistics describe gameplay frames only
+    m_Pacer->SetKeepStats(m_LogLatency && !idle);
+}
+
+void GameApp::FreezeGameplay() {
+    const int width = GetScreenWidth();
+    const int height = GetScreenHeight();
+
+    if (m_FrozenGameplay.id == 0 || m_FrozenGameplay.texture.width != width || m_FrozenGameplay.texture.height != height) {
+        if (m_FrozenGameplay.id != 0) {
+            UnloadRenderTexture(m_FrozenGameplay);
+        }
+        m_FrozenGameplay = LoadRenderTexture(width, height);
+        SetTextureWrap(m_FrozenGameplay.texture, TEXTURE_WRAP_CLAMP);
+        SetTextureFilter(m_FrozenGameplay.texture, TEXTURE_FILTER_BILINEAR); // Downscaled into the scene target
+    }
 
-    m_CrtShader = LoadShader(0, SHADER_PATH);
+    m_GameplayScreen->RenderOffscreen();
 
-    m_ResolutionLoc = GetShaderLocation(m_CrtShader, "resolution");
-    m_TimeLoc = GetShaderLocation(m_CrtShader, "time");
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.BeginTextureMode(m_FrozenGameplay);
+    backend.ClearBackground(SCENE_BACKGROUND);
+    m_GameplayScreen->Draw();
+    backend.EndTextureMode();
 
-    float resolution[2] = { static_cast<float>(screenWidth), static_cast<float>(screenHeight) };
-    SetShaderValue(m_CrtShader, m_ResolutionLoc, resolution, SHADER_UNIFORM_VEC2);
+    m_GameplayFrozen = true;
 }
 
 void GameApp::ChangeState(GameScreen newState) {
+    if (m_CurrentState == GameScreen::Playing && newState != GameScreen::Playing) {
+        m_Simulation->Pause();
+
+        if (newState == GameScreen::GameOver) {
+            m_Game->SaveProgress();
+        }
+    }
+
+    // Points and stats may have changed since the cached upgrades screen was painted
+    // (one that does not exist yet is painted fresh on first use)
+    if (newState == GameScreen::Upgrades && m_CurrentState != GameScreen::Upgrades && m_UpgradesScreen) {
+        m_UpgradesScreen->Invalidate();
+    }
     m_CurrentState = newState;
+
+    // The simulation only runs while playing; everything else waits for input
+    SetIdle(newState != GameScreen::Playing);
+    if (newState == GameScreen::Playing) {
+        m_GameplayFrozen = false;
+    }
+}
+
+PauseScreen& GameApp::GetPauseScreen() {
+    if (!m_PauseScreen) {
+        m_PauseScreen = std::make_unique<PauseScreen>(*m_Game, m_StateChangeCallback, m_Font, *m_Resolution);
+    }
+    return *m_PauseScreen;
+}
+
+UpgradesScreen& GameApp::GetUpgradesScreen() {
+    if (!m_UpgradesScreen) {
+        m_UpgradesScreen = std::make_unique<UpgradesScreen>(*m_Game, m_StateChangeCallback, m_Font);
+    }
+    return *m_UpgradesScreen;
+}
+
+LevelCompletedScreen& GameApp::GetLevelCompletedScreen() {
+    if (!m_LevelCompletedScreen) {
+        m_LevelCompletedScreen = std::make_unique<LevelCompletedScreen>(*m_Game, m_StateChangeCallback, m_Font);
+    }
+    return *m_LevelCompletedScreen;
+}
+
+GameoverScreen& GameApp::GetGameoverScreen() {
+    if (!m_GameoverScreen) {
+        m_GameoverScreen = std::make_unique<GameoverScreen>(*m_Game, m_StateChangeCallback, m_Font);
+    }
+    return *m_GameoverScreen;
 }
 
 void GameApp::Run() {
@@ -98,14 +338,17 @@ void GameApp::Run() {
     while (!WindowShouldClose() && m_CurrentState != GameScreen::Quit) {
         Update();
         Draw();
+        m_Pacer->Wait();
     }
 }
 
 void GameApp::Update() {
-    float deltaTime = GetFrameTime();
+    // Idle waits are not simulated or animated: the CRT stays still between events, and
+    // the first frames after leaving idle mode step effects by zero instead of the wait
+    float deltaTime = (m_Idle || m_StaleFrameTimes > 0) ? 0.0f : GetFrameTime();
     m_ElapsedTime += deltaTime;
 
-    SetShaderValue(m_CrtShader, m_TimeLoc, &m_ElapsedTime, SHADER_UNIFORM_FLOAT);
+    m_CrtPass->Update(m_ElapsedTime);
 
     if (m_CurrentState == GameScreen::Playing && m_PreviousState != GameScreen::Playing) {
         HideCursor();
@@ -115,6 +358,12 @@ void GameApp::Update() {
         m_Game->GetHealthService().SetMaxHealth(m_Game->GetUpgradeService().GetMaxHealth());
         m_Game->GetHealthService().SetRegenRate(m_Game->GetUpgradeService().GetRegenRate());
         m_Game->GetHealthService().RestoreToMax();
+
+        // Hand the game to the simulation thread until the next state change, starting
+        // from where the cursor is now rather than where it was when play stopped
+        Vector2 mouse = InputHandler::GetMousePosition();
+        m_Simulation->SetMousePosition(mouse.x, mouse.y);
+        m_Simulation->Resume();
     }
     else if (m_CurrentState != GameScreen::Playing && m_PreviousState == GameScreen::Playing) {
         ShowCursor();
@@ -129,16 +378,16 @@ void GameApp::Update() {
         m_GameplayScreen->Update(deltaTime);
         break;
     case GameScreen::Paused:
-        m_PauseScreen->Update(deltaTime);
+        GetPauseScreen().Update(deltaTime);
         break;
     case GameScreen::LevelCompleted:
-        m_LevelCompletedScreen->Update(deltaTime);
+        GetLevelCompletedScreen().Update(deltaTime);
         break;
     case GameScreen::Upgrades:
-        m_UpgradesScreen->Update(deltaTime);
+        GetUpgradesScreen().Update(deltaTime);
         break;
     case GameScreen::GameOver:
-        m_GameoverScreen->Update(deltaTime);
+        GetGameoverScreen().Update(deltaTime);
         break;
     case GameScreen::Quit:
         break;
@@ -146,53 +395,118 @@ void GameApp::Update() {
 }
 
 void GameApp::Draw() {
-    // Draw Game Content to Offscreen Buffer
-    BeginTextureMode(m_RenderTarget);
-    ClearBackground(Color{ 40, 40, 40, 255 });
-
     // Draw gameplay layer in background for certain screens (transparency overlay)
     bool drawGameplayBg = (m_CurrentState == GameScreen::Playing ||
         m_CurrentState == GameScreen::Paused ||
         m_CurrentState == GameScreen::LevelCompleted ||
         m_CurrentState == GameScreen::GameOver);
 
-    if (drawGameplayBg) {
+    // Offscreen layers must be rendered before the main target is bound
+    // (raylib texture modes do not nest). Behind a menu, the gameplay frame is
+    // rendered once and then reused until play resumes.
+    bool gameplayLive = m_CurrentState == GameScreen::Playing;
+    if (gameplayLive) {
+        m_GameplayScreen->RenderOffscreen();
+    }
+    else if (drawGameplayBg && !m_GameplayFrozen) {
+        FreezeGameplay();
+    }
+
+    // Menus repaint their cached layers only where something changed
+    switch (m_CurrentState) {
+    case GameScreen::Paused:         GetPauseScreen().RenderOffscreen(); break;
+    case GameScreen::LevelCompleted: GetLevelCompletedScreen().RenderOffscreen(); break;
+    case GameScreen::MainMenu:       m_MainScreen->RenderOffscreen(); break;
+    case GameScreen::Upgrades:       GetUpgradesScreen().RenderOffscreen(); break;
+    case GameScreen::GameOver:       GetGameoverScreen().RenderOffscreen(); break;
+    default:                         break;
+    }
+
+    // Idle frame times measure waiting for input, not rendering cost
+    if (!m_Idle && m_StaleFrameTimes == 0) {
+        UpdateQuality(drawGameplayBg);
+    }
+    UpdateRenderScale();
+
+    // Draw Game Content to Offscreen Buffer, scaled from screen coordinates down to the target size
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.BeginTextureMode(m_RenderTarget);
+    backend.ClearBackground(SCENE_BACKGROUND);
+
+    rlPushMatrix();
+    rlScalef(static_cast<float>(m_RenderTarget.texture.width) / GetScreenWidth(),
+        static_cast<float>(m_RenderTarget.texture.height) / GetScreenHeight(), 1.0f);
+
+    if (gameplayLive) {
         m_GameplayScreen->Draw();
     }
+    else if (drawGameplayBg) {
+        // Flipped vertically because of OpenGL texture coordinates
+        backend.DrawTextureRec(m_FrozenGameplay.texture,
+            Rectangle{ 0, 0, static_cast<float>(m_FrozenGameplay.texture.width), static_cast<float>(-m_FrozenGameplay.texture.height) },
+            Vector2{ 0, 0 }, WHITE);
+    }
 
     // Draw active UI
     switch (m_CurrentState) {
     case GameScreen::Playing:        break; // Already drawn above
-    case GameScreen::Paused:         m_PauseScreen->Draw(); break;
-    case GameScreen::LevelCompleted: m_LevelCompletedScreen->Draw(); break;
+    case GameScreen::Paused:         GetPauseScreen().Draw(); break;
+    case GameScreen::LevelCompleted: GetLevelCompletedScreen().Draw(); break;
     case GameScreen::MainMenu:       m_MainScreen->Draw(); break;
-    case GameScreen::Upgrades:       m_UpgradesScreen->Draw(); break;
-    case GameScreen::GameOver:       m_GameoverScreen->Draw(); break;
+    case GameScreen::Upgrades:       GetUpgradesScreen().Draw(); break;
+    case GameScreen::GameOver:       GetGameoverScreen().Draw(); break;
     case GameScreen::Quit:           break;
     }
 
-    EndTextureMode();
+    rlPopMatrix();
+    backend.EndTextureMode();
 
     // 2. Draw Buffer to Screen with Shader
     BeginDrawing();
     ClearBackground(BLACK);
 
-    BeginShaderMode(m_CrtShader);
-    // Draw texture flipped vertically because of OpenGL coordinates
-    DrawTextureRec(
-        m_RenderTarget.texture,
-        Rectangle{ 0, 0, static_cast<float>(m_RenderTarget.texture.width), static_cast<float>(-m_RenderTarget.texture.height) },
-        Vector2{ 0, 0 },
-        WHITE);
-    EndShaderMode();
+    m_CrtPass->Draw(m_RenderTarget.texture);
 
     EndDrawing();
+
+    if (m_LatencyLog) {
+        m_LatencyLog->RecordPresent();
+    }
+
+    if (m_StaleFrameTimes > 0) {
+        --m_StaleFrameTimes;
+    }
 }
 
 void GameApp::Cleanup() {
-    UnloadFont(m_Font);
-    UnloadShader(m_CrtShader);
+    // Join the simulation thread before anything it reads goes away
+    m_Simulation.reset();
+    m_LatencyLog.reset(); // Prints the latency summary
+    if (m_Pacer && m_LogLatency) {
+        m_Pacer->PrintSummary();
+    }
+    m_Pacer.reset();
+
+    // Menu screens own render textures, so release them while the GL context still exists
+    m_MainScreen.reset();
+    m_PauseScreen.reset();
+    m_UpgradesScreen.reset();
+    m_LevelCompletedScreen.reset();
+    m_GameoverScreen.reset();
+
+    Renderer::SetTextShader(Font{}, Shader{});
+    if (m_OwnsFont) {
+        UnloadFont(m_Font);
+        UnloadShader(m_TextShader);
+    }
+    UnloadTexture(m_GlowTexture);
+    UnloadTexture(m_ParticleTexture);
+    m_CrtPass.reset();
     UnloadRenderTexture(m_RenderTarget);
+    UnloadRenderTexture(m_NodeLayer);
+    if (m_FrozenGameplay.id != 0) {
+        UnloadRenderTexture(m_FrozenGameplay);
+    }
     ShowCursor();
     CloseWindow();
 }
\ No newline at end of file
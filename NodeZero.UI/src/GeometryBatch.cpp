@@ -0,0 +1,72 @@
+#include "GeometryBatch.h"
+
+#include <cmath>
+
+GeometryBatch::GeometryBatch() {
+    m_Vertices.reserve(INITIAL_VERTEX_CAPACITY);
+}
+
+void GeometryBatch::Clear() {
+    m_Vertices.clear();
+}
+
+void GeometryBatch::AddTriangle(Vector2 a, Vector2 b, Vector2 c, Color color) {
+    m_Vertices.push_back(ColorVertex{ a.x, a.y, color });
+    m_Vertices.push_back(ColorVertex{ b.x, b.y, color });
+    m_Vertices.push_back(ColorVertex{ c.x, c.y, color });
+}
+
+void GeometryBatch::AddQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d, Color color) {
+    AddTriangle(a, b, c, color);
+    AddTriangle(a, c, d, color);
+}
+
+void GeometryBatch::AddLine(Vector2 start, Vector2 end, float thickness, Color color) {
+    // Same construction as raylib's DrawLineEx (triangle strip around the segment)
+    float deltaX = end.x - start.x;
+    float deltaY = end.y - start.y;
+    float length = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+
+    if (length <= 0.0f || thickness <= 0.0f) {
+        return;
+    }
+
+    float scale = thickness / (2.0f * length);
+    Vector2 radius = { -scale * deltaY, scale * deltaX };
+
+    Vector2 p0 = { start.x - radius.x, start.y - radius.y };
+    Vector2 p1 = { start.x + radius.x, start.y + radius.y };
+    Vector2 p2 = { end.x - radius.x, end.y - radius.y };
+    Vector2 p3 = { end.x + radius.x, end.y + radius.y };
+
+    AddTriangle(p2, p0, p1, color);
+    AddTriangle(p3, p2, p1, color);
+}
+
+void GeometryBatch::AddConvexPolygon(const Vector2* vertices, int count, Color color) {
+    // Vertices come in increasing-angle order; emit the fan reversed (like DrawPoly)
+    // so the triangles keep raylib's counter-clockwise winding.
+    for (int i = 1; i < count - 1; ++i) {
+        AddTriangle(vertices[0], vertices[i + 1], vertices[i], color);
+    }
+}
+
+void GeometryBatch::AddPolygonRing(const Vector2* outer, const Vector2* inner, int count, Color color) {
+    for (int i = 0; i < count; ++i) {
+        int next = (i + 1) % count;
+        AddTriangle(outer[i], inner[i], inner[next], color);
+        AddTriangle(outer[i], inner[next], outer[next], color);
+    }
+}
+
+void GeometryBatch::Submit(IRenderBackend& backend) {
+    if (!m_Vertices.empty()) {
+        backend.DrawTriangles(m_Vertices.data(), static_cast<int>(m_Vertices.size()));
+    }
+
+    m_Vertices.clear();
+}
+
+size_t GeometryBatch::GetVertexCount() const {
+    return m_Vertices.size();
+}
@@ -2,11 +2,48 @@
 
 #include <cmath>
 
+#if defined(PLATFORM_DESKTOP)
+// raylib's desktop platform is built on GLFW and links it in; only these two calls are needed
+extern "C" {
+    typedef struct GLFWwindow GLFWwindow;
+    GLFWwindow* glfwGetCurrentContext(void);
+    void glfwGetCursorPos(GLFWwindow* window, double* xpos, double* ypos);
+}
+#endif
+
+static std::chrono::steady_clock::time_point s_LastSampleTime{};
+static uint64_t s_SampleCount = 0;
+
 // Forward calls to global Raylib functions
 Vector2 InputHandler::GetMousePosition() {
     return ::GetMousePosition();
 }
 
+Vector2 InputHandler::GetLatestMousePosition() {
+    s_LastSampleTime = std::chrono::steady_clock::now();
+    ++s_SampleCount;
+
+#if defined(PLATFORM_DESKTOP)
+    // Queries the window system directly (raylib only updates its copy in PollInputEvents)
+    if (GLFWwindow* window = glfwGetCurrentContext()) {
+        double x = 0.0;
+        double y = 0.0;
+        glfwGetCursorPos(window, &x, &y);
+        return Vector2{ static_cast<float>(x), static_cast<float>(y) };
+    }
+#endif
+
+    return ::GetMousePosition();
+}
+
+std::chrono::steady_clock::time_point InputHandler::GetLastSampleTime() {
+    return s_LastSampleTime;
+}
+
+uint64_t InputHandler::GetSampleCount() {
+    return s_SampleCount;
+}
+
 bool InputHandler::IsMouseButtonPressed(int button) {
     return ::IsMouseButtonPressed(button);
 }
@@ -0,0 +1,66 @@
+#include "InputLatencyLog.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+#include "InputHandler.h"
+
+InputLatencyLog::~InputLatencyLog() {
+    Close();
+}
+
+bool InputLatencyLog::Open(const std::string& path) {
+    Close();
+
+    m_File.open(path, std::ios::out | std::ios::trunc);
+    if (!m_File) {
+        std::cerr << "InputLatencyLog: could not create " << path << std::endl;
+        return false;
+    }
+
+    m_Path = path;
+    m_File << "frame,latency_ms\n";
+    m_Latencies.clear();
+    m_LastSampleCount = InputHandler::GetSampleCount();
+    m_Frame = 0;
+    return true;
+}
+
+bool InputLatencyLog::IsOpen() const {
+    return m_File.is_open();
+}
+
+void InputLatencyLog::RecordPresent() {
+    if (!m_File.is_open()) return;
+
+    auto presented = std::chrono::steady_clock::now();
+    ++m_Frame;
+
+    // Menus do not late-latch the cursor; only gameplay frames are measured
+    uint64_t sampleCount = InputHandler::GetSampleCount();
+    if (sampleCount == m_LastSampleCount) return;
+    m_LastSampleCount = sampleCount;
+
+    float latency = std::chrono::duration<float, std::milli>(presented - InputHandler::GetLastSampleTime()).count();
+    m_Latencies.push_back(latency);
+    m_File << m_Frame << ',' << latency << '\n';
+}
+
+void InputLatencyLog::Close() {
+    if (!m_File.is_open()) return;
+    m_File.close();
+
+    if (m_Latencies.empty()) {
+        std::cout << "Input latency: no gameplay frames recorded (" << m_Path << ")" << std::endl;
+        return;
+    }
+
+    float average = std::accumulate(m_Latencies.begin(), m_Latencies.end(), 0.0f) / m_Latencies.size();
+    std::sort(m_Latencies.begin(), m_Latencies.end());
+    float median = m_Latencies[m_Latencies.size() / 2];
+    float p99 = m_Latencies[(m_Latencies.size() - 1) * 99 / 100];
+
+    std::cout << "Input latency over " << m_Latencies.size() << " frames: avg " << average
+        << " ms, p50 " << median << " ms, p99 " << p99 << " ms (" << m_Path << ")" << std::endl;
+}
@@ -0,0 +1,150 @@
+#include "ParticleSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+static int NextPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+static unsigned char JitterChannel(unsigned char channel, int offset) {
+    return static_cast<unsigned char>(std::clamp(static_cast<int>(channel) + offset, 0, 255));
+}
+
+ParticleSystem::ParticleSystem(int capacity, float gravity)
+    : m_Capacity(NextPowerOfTwo(std::max(1, capacity))),
+    m_Mask(m_Capacity - 1),
+    m_Gravity(gravity) {
+    m_PositionX.resize(m_Capacity);
+    m_PositionY.resize(m_Capacity);
+    m_VelocityX.resize(m_Capacity);
+    m_VelocityY.resize(m_Capacity);
+    m_Age.resize(m_Capacity);
+    m_InverseLifetime.resize(m_Capacity);
+    m_Size.resize(m_Capacity);
+    m_Colors.resize(m_Capacity);
+}
+
+void ParticleSystem::Emit(const ParticleBurst& burst) {
+    float inverseLifetime = 1.0f / std::max(burst.lifetime, 0.001f);
+    int variance = std::max(1, burst.colorVariance);
+
+    for (int n = 0; n < burst.count; ++n) {
+        int slot = m_Head;
+        m_Head = (m_Head + 1) & m_Mask;
+        m_Count = std::min(m_Count + 1, m_Capacity); // Full: the oldest slot is overwritten
+
+        float angle = NextFloat() * 2.0f * PI;
+        float speed = burst.speedMin + NextFloat() * (burst.speedMax - burst.speedMin);
+
+        m_PositionX[slot] = burst.position.x;
+        m_PositionY[slot] = burst.position.y;
+        m_VelocityX[slot] = cosf(angle) * speed;
+        m_VelocityY[slot] = sinf(angle) * speed;
+        m_Age[slot] = 0.0f;
+        m_InverseLifetime[slot] = inverseLifetime;
+        m_Size[slot] = burst.sizeMin + NextFloat() * (burst.sizeMax - burst.sizeMin);
+
+        // One random number supplies all three channel offsets
+        uint32_t bits = NextRandom();
+        int range = 2 * variance;
+        m_Colors[slot] = Color{
+            JitterChannel(burst.baseColor.r, static_cast<int>(bits % range) - variance),
+            JitterChannel(burst.baseColor.g, static_cast<int>((bits >> 10) % range) - variance),
+            JitterChannel(burst.baseColor.b, static_cast<int>((bits >> 20) % range) - variance),
+            255
+        };
+    }
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    if (m_Count == 0) return;
+
+    int tail = (m_Head - m_Count) & m_Mask;
+    if (tail + m_Count <= m_Capacity) {
+        IntegrateSpan(tail, tail + m_Count, deltaTime);
+    }
+    else {
+        IntegrateSpan(tail, m_Capacity, deltaTime);
+        IntegrateSpan(0, m_Head, deltaTime);
+    }
+
+    // Retire expired particles from the oldest end
+    while (m_Count > 0 && m_Age[tail] * m_InverseLifetime[tail] >= 1.0f) {
+        tail = (tail + 1) & m_Mask;
+        --m_Count;
+    }
+}
+
+void ParticleSystem::IntegrateSpan(int begin, int end, float deltaTime) {
+    float* __restrict positionX = m_PositionX.data();
+    float* __restrict positionY = m_PositionY.data();
+    const float* __restrict velocityX = m_VelocityX.data();
+    float* __restrict velocityY = m_VelocityY.data();
+    float* __restrict age = m_Age.data();
+    const float gravityStep = m_Gravity * deltaTime;
+
+    // Same order as before: move with the current velocity, then accelerate
+    for (int i = begin; i < end; ++i) {
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        velocityY[i] += gravityStep;
+        age[i] += deltaTime;
+    }
+}
+
+void ParticleSystem::Draw(SpriteBatch& batch) const {
+    if (m_Count == 0) return;
+
+    int tail = (m_Head - m_Count) & m_Mask;
+    if (tail + m_Count <= m_Capacity) {
+        DrawSpan(tail, tail + m_Count, batch);
+    }
+    else {
+        DrawSpan(tail, m_Capacity, batch);
+        DrawSpan(0, m_Head, batch);
+    }
+}
+
+void ParticleSystem::DrawSpan(int begin, int end, SpriteBatch& batch) const {
+    TextureVertex* quads = batch.AppendSprites(end - begin);
+
+    // Branch-free: an expired particle not yet retired is written with alpha 0
+    for (int i = begin; i < end; ++i) {
+        float fade = std::max(0.0f, 1.0f - m_Age[i] * m_InverseLifetime[i]);
+
+        Color color = m_Colors[i];
+        color.a = static_cast<unsigned char>(fade * 255.0f);
+        SpriteBatch::WriteSprite(quads, m_PositionX[i], m_PositionY[i], m_Size[i], color);
+        quads += 4;
+    }
+}
+
+void ParticleSystem::Clear() {
+    m_Head = 0;
+    m_Count = 0;
+}
+
+int ParticleSystem::GetCount() const {
+    return m_Count;
+}
+
+int ParticleSystem::GetCapacity() const {
+    return m_Capacity;
+}
+
+uint32_t ParticleSystem::NextRandom() {
+    uint32_t x = m_RandomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_RandomState = x;
+    return x;
+}
+
+float ParticleSystem::NextFloat() {
+    // Top 24 bits -> exactly representable float in [0, 1)
+    return (NextRandom() >> 8) * (1.0f / 16777216.0f);
+}
@@ -2,177 +2,351 @@
 
 #include <cmath>
 #include <string>
-#include <vector>
 #include <cstdio>
 #include <algorithm>
+#include <array>
 
+#include "Rendering/QualityGovernor.h"
+#include "Rendering/RaylibRenderBackend.h"
+#include "Rendering/TextCache.h"
 #include "raymath.h"
 
 // Constants for drawing precision
-static constexpr int CIRCLE_SEGMENTS = 32;
+static constexpr int CIRCLE_LOD_SEGMENTS[] = { 8, 12, 16, 24, 32, 48 }; // Multiples of 4 keep the HP fill extent at 1
+static constexpr int CIRCLE_LOD_COUNT = sizeof(CIRCLE_LOD_SEGMENTS) / sizeof(CIRCLE_LOD_SEGMENTS[0]);
+static constexpr float CIRCLE_MAX_ERROR = 0.5f; // Max gap between the true circle and its polygon (Pixels)
 static constexpr int HEXAGON_SIDES = 6;
+static constexpr int SQUARE_SIDES = 4;
 static constexpr float LINE_THICKNESS_RATIO = 0.003f; // Relative to screen height
-
-void Renderer::DrawCircleNode(float x, float y, float size, float hpPercentage, Color color, float rotation) {
-    std::vector<Vector2> vertices;
-    vertices.reserve(CIRCLE_SEGMENTS);
-    for (int i = 0; i < CIRCLE_SEGMENTS; ++i) {
-        float angle = (rotation + i * (360.0f / CIRCLE_SEGMENTS)) * DEG2RAD;
-        vertices.push_back({ x + size * cosf(angle), y + size * sinf(angle) });
+static constexpr float DISC_EDGE_DENSITY = 0.85f; // Solid part of the disc sprite; the rest is the anti-aliased edge
+
+// Default target when no backend has been injected
+static RaylibRenderBackend s_DefaultBackend;
+static IRenderBackend* s_Backend = &s_DefaultBackend;
+
+/**
+ * @struct HudText
+ * @brief A HUD string that is only formatted and laid out again when its inputs change.
+ *
+ * Inputs are the values as displayed (e.g. health rounded to one decimal), so a value
+ * that moves without changing its text does not trigger a rebuild either.
+ */
+struct HudText {
+    TextRun run;
+    std::array<double, 3> inputs{};
+    unsigned int fontTexture{ 0 };
+    float fontSize{ 0.0f };
+    bool built{ false };
+
+    /** @brief Stores the new inputs and returns true if the text has to be rebuilt. */
+    bool NeedsRebuild(const std::array<double, 3>& values, Font font, float size) {
+        if (built && values == inputs && font.texture.id == fontTexture && size == fontSize) {
+            return false;
+        }
+        inputs = values;
+        fontTexture = font.texture.id;
+        fontSize = size;
+        built = true;
+        return true;
     }
+};
+
+static HudText s_FpsText;
+static HudText s_NodesText;
+static HudText s_DrawCallsText;
+static HudText s_QualityText;
+static HudText s_QualityStepText;
+static HudText s_PointsText;
+static HudText s_HealthText;
+static HudText s_LevelText;
+
+// Clipping a convex polygon against one half-plane adds at most one vertex
+static constexpr int MAX_POLYGON_VERTICES = CIRCLE_LOD_SEGMENTS[CIRCLE_LOD_COUNT - 1];
+static constexpr int MAX_CLIPPED_VERTICES = MAX_POLYGON_VERTICES + 1;
+
+/**
+ * @struct UnitPolygon
+ * @brief Precomputed outline of a shape with unit size, centered on the origin.
+ *
+ * Vertices are stored in increasing-angle order. `extent` is the half-height of
+ * the shape along the local Y axis, which is the axis the HP fill drains along.
+ */
+struct UnitPolygon {
+    Vector2 vertices[MAX_POLYGON_VERTICES];
+    int count;
+    float extent;
+};
+
+static UnitPolygon MakeRegularPolygon(int sides, float startAngle, float radius) {
+    UnitPolygon polygon{};
+    polygon.count = sides;
+    polygon.extent = 0.0f;
+
+    for (int i = 0; i < sides; ++i) {
+        float angle = (startAngle + i * (360.0f / sides)) * DEG2RAD;
+        polygon.vertices[i] = { radius * cosf(angle), radius * sinf(angle) };
+        polygon.extent = std::max(polygon.extent, std::fabs(polygon.vertices[i].y));
+    }
+    return polygon;
+}
 
-    // Logic: If HP < 100%, we clip the polygon using a geometric "fill direction"
-    // to simulate the shape emptying out.
-    if (hpPercentage > 0.0f) {
-        if (hpPercentage >= 1.0f) {
-            DrawPoly(Vector2{ x, y }, CIRCLE_SEGMENTS, size, rotation, color);
+/**
+ * @struct CircleLod
+ * @brief One circle tessellation level and the largest radius it is accurate enough for.
+ */
+struct CircleLod {
+    UnitPolygon shape;
+    float maxRadius;
+};
+
+// Tables are built once on first use; per node only a single sin/cos pair is evaluated
+static const CircleLod* GetCircleLods() {
+    static const auto lods = [] {
+        std::array<CircleLod, CIRCLE_LOD_COUNT> levels{};
+        for (int i = 0; i < CIRCLE_LOD_COUNT; ++i) {
+            int segments = CIRCLE_LOD_SEGMENTS[i];
+            levels[i].shape = MakeRegularPolygon(segments, 0.0f, 1.0f);
+
+            // Sagitta of one segment: r * (1 - cos(pi / n)) must stay below the error budget
+            levels[i].maxRadius = CIRCLE_MAX_ERROR / (1.0f - cosf(PI / segments));
         }
-        else {
-            // Complex polygon clipping logic for partial fill
-            float rad = rotation * DEG2RAD;
-            Vector2 fillDir = { sinf(rad), -cosf(rad) };
-            float limit = -size + hpPercentage * 2.0f * size;
-
-            std::vector<Vector2> clippedVertices;
-            Vector2 center = { x, y };
-            Vector2 p1 = vertices.back();
-            float dist1 = Vector2DotProduct(Vector2Subtract(p1, center), fillDir);
-            bool p1Inside = (dist1 <= limit);
-
-            for (const auto& p2 : vertices) {
-                float dist2 = Vector2DotProduct(Vector2Subtract(p2, center), fillDir);
-                bool p2Inside = (dist2 <= limit);
-
-                if (p1Inside && p2Inside) {
-                    clippedVertices.push_back(p2);
-                }
-                else if (p1Inside && !p2Inside) {
-                    float t = (limit - dist1) / (dist2 - dist1);
-                    clippedVertices.push_back(Vector2Add(p1, Vector2Scale(Vector2Subtract(p2, p1), t)));
-                }
-                else if (!p1Inside && p2Inside) {
-                    float t = (limit - dist1) / (dist2 - dist1);
-                    clippedVertices.push_back(Vector2Add(p1, Vector2Scale(Vector2Subtract(p2, p1), t)));
-                    clippedVertices.push_back(p2);
-                }
-                p1 = p2; dist1 = dist2; p1Inside = p2Inside;
-            }
+        return levels;
+    }();
+    return lods.data();
+}
 
-            if (clippedVertices.size() >= 3) {
-                Vector2 centerFan = clippedVertices[0];
-                for (size_t i = 1; i < clippedVertices.size() - 1; ++i) {
-                    DrawTriangle(centerFan, clippedVertices[i + 1], clippedVertices[i], color);
-                }
-            }
+/** @brief Coarsest circle table whose edge error stays sub-pixel at the given on-screen radius. */
+static const UnitPolygon& GetCircleTable(float radius) {
+    const CircleLod* lods = GetCircleLods();
+    for (int i = 0; i < CIRCLE_LOD_COUNT - 1; ++i) {
+        if (radius <= lods[i].maxRadius) {
+            return lods[i].shape;
         }
     }
+    return lods[CIRCLE_LOD_COUNT - 1].shape;
+}
+
+static const UnitPolygon& GetSquareTable() {
+    // Corners at (+-1, +-1): radius sqrt(2), starting at 45 degrees
+    static const UnitPolygon table = MakeRegularPolygon(SQUARE_SIDES, 45.0f, std::sqrt(2.0f));
+    return table;
+}
 
-    float borderThickness = GetScreenHeight() * LINE_THICKNESS_RATIO;
-    DrawPolyLinesEx(Vector2{ x, y }, CIRCLE_SEGMENTS, size, rotation, borderThickness, color);
+static const UnitPolygon& GetHexagonTable() {
+    static const UnitPolygon table = MakeRegularPolygon(HEXAGON_SIDES, 0.0f, 1.0f);
+    return table;
 }
 
-void Renderer::DrawSquareNode(float x, float y, float size, float hpPercentage, Color color, float rotation) {
+/**
+ * @brief Emits a node shape (HP fill + outline) into the batch.
+ *
+ * The fill is clipped in unit space against the line `-v.y <= limit`, so the shape
+ * empties from its local top as HP drops, then every vertex is placed with a single
+ * 2x2 rotation + scale. All buffers live on the stack.
+ */
+static void DrawUnitPolygonNode(GeometryBatch& batch, const UnitPolygon& shape, float x, float y, float size,
+    float hpPercentage, Color color, float rotation) {
     float rad = rotation * DEG2RAD;
     float cosA = cosf(rad);
     float sinA = sinf(rad);
 
-    // Calculate 4 corners of rotated square
-    Vector2 corners[4] = {
-        {x + (-size * cosA - (-size) * sinA), y + (-size * sinA + (-size) * cosA)},
-        {x + (size * cosA - (-size) * sinA), y + (size * sinA + (-size) * cosA)},
-        {x + (-size * cosA - size * sinA), y + (-size * sinA + size * cosA)},
-        {x + (size * cosA - size * sinA), y + (size * sinA + size * cosA)}
+    auto toWorld = [&](Vector2 v, float scale) {
+        return Vector2{ x + scale * (v.x * cosA - v.y * sinA), y + scale * (v.x * sinA + v.y * cosA) };
     };
 
-    if (hpPercentage > 0.0f) {
-        // Simplified fill logic for square (lerping diagonal)
-        float fillRatio = hpPercentage;
-        Vector2 fillTopLeft = {
-            corners[2].x + (corners[0].x - corners[2].x) * fillRatio,
-            corners[2].y + (corners[0].y - corners[2].y) * fillRatio };
-        Vector2 fillTopRight = {
-            corners[3].x + (corners[1].x - corners[3].x) * fillRatio,
-            corners[3].y + (corners[1].y - corners[3].y) * fillRatio };
-
-        DrawTriangle(corners[2], fillTopRight, fillTopLeft, color);
-        DrawTriangle(corners[2], corners[3], fillTopRight, color);
+    Vector2 outer[MAX_POLYGON_VERTICES];
+    for (int i = 0; i < shape.count; ++i) {
+        outer[i] = toWorld(shape.vertices[i], size);
     }
 
-    float borderThickness = GetScreenHeight() * LINE_THICKNESS_RATIO;
-    DrawLineEx(corners[0], corners[1], borderThickness, color);
-    DrawLineEx(corners[1], corners[3], borderThickness, color);
-    DrawLineEx(corners[3], corners[2], borderThickness, color);
-    DrawLineEx(corners[2], corners[0], borderThickness, color);
-}
-
-void Renderer::DrawHexagonNode(float x, float y, float size, float hpPercentage, Color color, float rotation) {
-    // Similar logic to Circle, but fewer sides
-    std::vector<Vector2> vertices;
-    vertices.reserve(HEXAGON_SIDES);
-    for (int i = 0; i < HEXAGON_SIDES; ++i) {
-        float angle = DEG2RAD * (rotation + i * 60.0f);
-        vertices.push_back({ x + size * cosf(angle), y + size * sinf(angle) });
+    if (hpPercentage >= 1.0f) {
+        batch.AddConvexPolygon(outer, shape.count, color);
     }
+    else if (hpPercentage > 0.0f) {
+        float limit = -shape.extent + hpPercentage * 2.0f * shape.extent;
 
-    // Reuse generic polygon clipping logic (same as CircleNode above)
-    // ... [Logic is identical to DrawCircleNode but using vertices] ...
-    // For brevity in refactoring, you would ideally extract "DrawClippedPoly" as a private helper method
-    // to avoid duplicating the math 3 times. But keeping it inline here to match your structure.
+        Vector2 clipped[MAX_CLIPPED_VERTICES];
+        int clippedCount = 0;
 
-    // ... (Clipping logic omitted for brevity, exact copy of Circle logic) ...
-    // Note: In a real refactor, create: 
-    // void DrawClippedPolygon(std::vector<Vector2>& verts, float hp, Color c, Vector2 center, float size, float rot);
+        Vector2 p1 = shape.vertices[shape.count - 1];
+        float dist1 = -p1.y;
+        bool p1Inside = (dist1 <= limit);
 
-    // Render full if 100%
-    if (hpPercentage >= 1.0f) {
-        DrawPoly(Vector2{ x, y }, HEXAGON_SIDES, size, rotation, color);
+        for (int i = 0; i < shape.count; ++i) {
+            Vector2 p2 = shape.vertices[i];
+            float dist2 = -p2.y;
+            bool p2Inside = (dist2 <= limit);
+
+            if (p1Inside != p2Inside) {
+                float t = (limit - dist1) / (dist2 - dist1);
+                clipped[clippedCount++] = Vector2{ p1.x + (p2.x - p1.x) * t, p1.y + (p2.y - p1.y) * t };
+            }
+            if (p2Inside) {
+                clipped[clippedCount++] = p2;
+            }
+            p1 = p2; dist1 = dist2; p1Inside = p2Inside;
+        }
+
+        if (clippedCount >= 3) {
+            for (int i = 0; i < clippedCount; ++i) {
+                clipped[i] = toWorld(clipped[i], size);
+            }
+            batch.AddConvexPolygon(clipped, clippedCount, color);
+        }
     }
 
-    float borderThickness = GetScreenHeight() * LINE_THICKNESS_RATIO;
-    DrawPolyLinesEx(Vector2{ x, y }, HEXAGON_SIDES, size, rotation, borderThickness, color);
+    // Outline: the ring is thickened inwards, like DrawPolyLinesEx
+    float borderThickness = Renderer::GetBackend().GetScreenHeight() * LINE_THICKNESS_RATIO;
+    float innerSize = std::max(0.0f, size - borderThickness);
+
+    Vector2 inner[MAX_POLYGON_VERTICES];
+    for (int i = 0; i < shape.count; ++i) {
+        inner[i] = toWorld(shape.vertices[i], innerSize);
+    }
+    batch.AddPolygonRing(outer, inner, shape.count, color);
+}
+
+void Renderer::SetBackend(IRenderBackend* backend) {
+    s_Backend = backend ? backend : &s_DefaultBackend;
+}
+
+IRenderBackend& Renderer::GetBackend() {
+    return *s_Backend;
+}
+
+void Renderer::SetTextShader(Font font, Shader shader) {
+    s_DefaultBackend.SetTextShader(font.texture, shader);
+}
+
+void Renderer::DrawCircleNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation) {
+    DrawUnitPolygonNode(batch, GetCircleTable(size), x, y, size, hpPercentage, color, rotation);
+}
+
+void Renderer::DrawSquareNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation) {
+    DrawUnitPolygonNode(batch, GetSquareTable(), x, y, size, hpPercentage, color, rotation);
+}
+
+void Renderer::DrawHexagonNode(GeometryBatch& batch, float x, float y, float size, float hpPercentage, Color color, float rotation) {
+    DrawUnitPolygonNode(batch, GetHexagonTable(), x, y, size, hpPercentage, color, rotation);
+}
+
+/** @brief White radial sprite: opaque up to `density` of the radius, then fading to transparent. */
+static Texture2D GenerateRadialTexture(int size, float density) {
+    // Outer color keeps white RGB so bilinear filtering only fades alpha (no dark fringe)
+    Image image = GenImageGradientRadial(size, size, density, WHITE, Color{ 255, 255, 255, 0 });
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    SetTextureWrap(texture, TEXTURE_WRAP_CLAMP);
+    return texture;
+}
+
+Texture2D Renderer::GenerateGlowTexture(int size) {
+    return GenerateRadialTexture(size, 0.0f);
+}
+
+Texture2D Renderer::GenerateDiscTexture(int size) {
+    return GenerateRadialTexture(size, DISC_EDGE_DENSITY);
 }
 
 void Renderer::DrawPickup(float x, float y, float size, Color color) {
-    float thickness = GetScreenHeight() * 0.002f;
-    DrawLineEx(Vector2{ x - size, y }, Vector2{ x + size, y }, thickness, color);
-    DrawLineEx(Vector2{ x, y - size }, Vector2{ x, y + size }, thickness, color);
+    IRenderBackend& backend = GetBackend();
+    float thickness = backend.GetScreenHeight() * 0.002f;
+    backend.DrawLineEx(Vector2{ x - size, y }, Vector2{ x + size, y }, thickness, color);
+    backend.DrawLineEx(Vector2{ x, y - size }, Vector2{ x, y + size }, thickness, color);
 }
 
-void Renderer::DrawDebugInfo(int posX, int posY, Font font) {
-    std::string fpsText = "FPS: " + std::to_string(GetFPS());
-    int fontSize = static_cast<int>(GetScreenHeight() * 0.025f);
-    Vector2 textSize = MeasureTextEx(font, fpsText.c_str(), static_cast<float>(fontSize), 1);
-    DrawTextEx(font, fpsText.c_str(), Vector2{ posX - textSize.x, static_cast<float>(posY) }, static_cast<float>(fontSize), 1, WHITE);
+void Renderer::DrawDebugInfo(int posX, int posY, Font font, int liveNodes, int peakNodes, int drawCalls, const QualityGovernor* governor) {
+    IRenderBackend& backend = GetBackend();
+    int fps = backend.GetFPS();
+    float fontSize = static_cast<float>(static_cast<int>(backend.GetScreenHeight() * 0.025f));
+
+    if (s_FpsText.NeedsRebuild({ static_cast<double>(fps), 0.0, 0.0 }, font, fontSize)) {
+        std::string fpsText = "FPS: " + std::to_string(fps);
+        s_FpsText.run.Build(fpsText.c_str(), font, fontSize, 1);
+    }
+    Vector2 textSize = s_FpsText.run.GetSize();
+    s_FpsText.run.Draw(backend, Vector2{ posX - textSize.x, static_cast<float>(posY) }, WHITE);
+
+    if (s_NodesText.NeedsRebuild({ static_cast<double>(liveNodes), static_cast<double>(peakNodes), 0.0 }, font, fontSize)) {
+        std::string nodesText = "Nodes: " + std::to_string(liveNodes) + " / " + std::to_string(peakNodes);
+        s_NodesText.run.Build(nodesText.c_str(), font, fontSize, 1);
+    }
+    Vector2 nodesSize = s_NodesText.run.GetSize();
+    s_NodesText.run.Draw(backend, Vector2{ posX - nodesSize.x, posY + textSize.y }, WHITE);
+
+    if (s_DrawCallsText.NeedsRebuild({ static_cast<double>(drawCalls), 0.0, 0.0 }, font, fontSize)) {
+        std::string drawCallsText = "Draw calls: " + std::to_string(drawCalls);
+        s_DrawCallsText.run.Build(drawCallsText.c_str(), font, fontSize, 1);
+    }
+    Vector2 drawCallsSize = s_DrawCallsText.run.GetSize();
+    s_DrawCallsText.run.Draw(backend, Vector2{ posX - drawCallsSize.x, posY + textSize.y * 2.0f }, WHITE);
+
+    if (!governor) return;
+
+    QualityTier tier = governor->GetTier();
+    if (s_QualityText.NeedsRebuild({ static_cast<double>(tier), 0.0, 0.0 }, font, fontSize)) {
+        std::string qualityText = std::string("Quality: ") + QualityGovernor::GetTierName(tier);
+        s_QualityText.run.Build(qualityText.c_str(), font, fontSize, 1);
+    }
+    Vector2 qualitySize = s_QualityText.run.GetSize();
+    s_QualityText.run.Draw(backend, Vector2{ posX - qualitySize.x, posY + textSize.y * 3.0f }, WHITE);
+
+    if (!governor->HasStepped()) return;
+
+    // The step line shows which way the tier moved and the p95 frame time that moved it
+    const QualityStep& step = governor->GetLastStep();
+    float stepMs = step.percentileFrameTime * 1000.0f;
+    if (s_QualityStepText.NeedsRebuild({ static_cast<double>(step.from), static_cast<double>(step.to), std::round(stepMs * 10.0f) }, font, fontSize)) {
+        char stepText[96];
+        snprintf(stepText, sizeof(stepText), "%s: %s > %s (p95 %.1f ms)",
+            step.to > step.from ? "Down" : "Up",
+            QualityGovernor::GetTierName(step.from), QualityGovernor::GetTierName(step.to), stepMs);
+        s_QualityStepText.run.Build(stepText, font, fontSize, 1);
+    }
+    Vector2 stepSize = s_QualityStepText.run.GetSize();
+    s_QualityStepText.run.Draw(backend, Vector2{ posX - stepSize.x, posY + textSize.y * 4.0f }, WHITE);
 }
 
 void Renderer::DrawPoints(int points, int posX, int posY, int fontSize, Color color, Font font) {
-    std::string pointsText = "Points: " + std::to_string(points);
-    DrawTextEx(font, pointsText.c_str(), Vector2{ static_cast<float>(posX), static_cast<float>(posY) }, static_cast<float>(fontSize), 1, color);
+    IRenderBackend& backend = GetBackend();
+    if (s_PointsText.NeedsRebuild({ static_cast<double>(points), 0.0, 0.0 }, font, static_cast<float>(fontSize))) {
+        std::string pointsText = "Points: " + std::to_string(points);
+        s_PointsText.run.Build(pointsText.c_str(), font, static_cast<float>(fontSize), 1);
+    }
+    s_PointsText.run.Draw(backend, Vector2{ static_cast<float>(posX), static_cast<float>(posY) }, color);
 }
 
 void Renderer::DrawHealthBar(float health, float maxHealth, int posX, int posY, int width, int height, Font font) {
-    DrawRectangle(posX, posY, width, height, Color{ 60, 60, 60, 255 }); // Background
+    IRenderBackend& backend = GetBackend();
+    backend.DrawRectangle(posX, posY, width, height, Color{ 60, 60, 60, 255 }); // Background
 
     float healthPercentage = std::clamp(health / maxHealth, 0.0f, 1.0f);
     int barWidth = static_cast<int>(width * healthPercentage);
 
-    DrawRectangle(posX, posY, barWidth, height, Color{ 255, 50, 50, 255 }); // Fill
-    DrawRectangleLines(posX, posY, width, height, WHITE); // Border
+    backend.DrawRectangle(posX, posY, barWidth, height, Color{ 255, 50, 50, 255 }); // Fill
+    backend.DrawRectangleLines(posX, posY, width, height, WHITE); // Border
 
-    char healthBuffer[32];
-    snprintf(healthBuffer, sizeof(healthBuffer), "%.1f / %.0f", health, maxHealth);
+    // Regen moves health every frame, but the text only changes every 0.1 HP
+    float healthTextSize = static_cast<float>(static_cast<int>(height * 0.65f));
+    if (s_HealthText.NeedsRebuild({ std::round(health * 10.0), std::round(maxHealth), 0.0 }, font, healthTextSize)) {
+        char healthBuffer[32];
+        snprintf(healthBuffer, sizeof(healthBuffer), "%.1f / %.0f", health, maxHealth);
+        s_HealthText.run.Build(healthBuffer, font, healthTextSize, 1);
+    }
 
-    int healthTextSize = static_cast<int>(height * 0.65f);
-    Vector2 textSize = MeasureTextEx(font, healthBuffer, static_cast<float>(healthTextSize), 1);
+    Vector2 textSize = s_HealthText.run.GetSize();
     float textX = posX + (width - textSize.x) / 2.0f;
     float textY = posY + (height - textSize.y) / 2.0f;
 
-    DrawTextEx(font, healthBuffer, Vector2{ textX, textY }, static_cast<float>(healthTextSize), 1, WHITE);
+    s_HealthText.run.Draw(backend, Vector2{ textX, textY }, WHITE);
 }
 
 void Renderer::DrawProgressBar(float percentage, int currentLevel, Font font) {
-    int screenWidth = GetScreenWidth();
-    int screenHeight = GetScreenHeight();
+    IRenderBackend& backend = GetBackend();
+    int screenWidth = backend.GetScreenWidth();
+    int screenHeight = backend.GetScreenHeight();
 
     // UI Proportions
     int height = static_cast<int>(screenHeight * 0.03f);
@@ -183,18 +357,21 @@ void Renderer::DrawProgressBar(float percentage, int currentLevel, Font font) {
     int posX = sideMargin;
     int width = screenWidth - (sideMargin * 2);
 
-    DrawRectangle(posX, posY, width, height, Color{ 20, 20, 30, 220 }); // Background
+    backend.DrawRectangle(posX, posY, width, height, Color{ 20, 20, 30, 220 }); // Background
 
     int fillWidth = static_cast<int>(width * (percentage / 100.0f));
-    DrawRectangle(posX, posY, fillWidth, height, Color{ 255, 255, 255, 255 }); // Fill
-    DrawRectangleLines(posX, posY, width, height, WHITE); // Border
-
-    char label[64];
-    snprintf(label, sizeof(label), "Level %d - progress", currentLevel);
-    int labelSize = static_cast<int>(screenHeight * 0.025f);
-    Vector2 textSize = MeasureTextEx(font, label, static_cast<float>(labelSize), 1);
+    backend.DrawRectangle(posX, posY, fillWidth, height, Color{ 255, 255, 255, 255 }); // Fill
+    backend.DrawRectangleLines(posX, posY, width, height, WHITE); // Border
+
+    float labelSize = static_cast<float>(static_cast<int>(screenHeight * 0.025f));
+    if (s_LevelText.NeedsRebuild({ static_cast<double>(currentLevel), 0.0, 0.0 }, font, labelSize)) {
+        char label[64];
+        snprintf(label, sizeof(label), "Level %d - progress", currentLevel);
+        s_LevelText.run.Build(label, font, labelSize, 1);
+    }
+    Vector2 textSize = s_LevelText.run.GetSize();
 
-    DrawTextEx(font, label,
+    s_LevelText.run.Draw(backend,
         Vector2{ static_cast<float>((screenWidth - textSize.x) / 2), static_cast<float>(posY - screenHeight * 0.035f) },
-        static_cast<float>(labelSize), 1, Color{ 200, 200, 200, 255 });
+        Color{ 200, 200, 200, 255 });
 }
\ No newline at end of file
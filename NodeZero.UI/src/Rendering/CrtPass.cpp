@@ -0,0 +1,251 @@
+#include "Rendering/CrtPass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "Rendering/ShaderCache.h"
+
+CrtPass::~CrtPass() {
+    Unload();
+}
+
+CrtPass::Assets CrtPass::Prepare(const char* shaderSource, int screenHeight) {
+    Assets assets;
+    assets.screenHeight = screenHeight;
+
+    // Defines must follow #version, so the file's own version line is replaced per variant
+    assets.source = shaderSource ? shaderSource : "";
+    if (assets.source.compare(0, 8, "#version") == 0) {
+        size_t lineEnd = assets.source.find('\n');
+        assets.source.erase(0, lineEnd == std::string::npos ? assets.source.size() : lineEnd + 1);
+    }
+
+    assets.maskPixels = GenerateMask(screenHeight);
+    assets.noisePixels = GenerateBlueNoise(NOISE_SIZE);
+    return assets;
+}
+
+void CrtPass::Load(const Assets& assets, int screenWidth) {
+    Unload();
+    m_ScreenWidth = screenWidth;
+    m_ScreenHeight = assets.screenHeight;
+    m_Source = assets.source;
+
+    // The Images only borrow the pixels; LoadTextureFromImage copies them to the GPU
+    Image mask{ const_cast<unsigned char*>(assets.maskPixels.data()), MASK_WIDTH, m_ScreenHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+    m_MaskTexture = LoadTextureFromImage(mask);
+    SetTextureFilter(m_MaskTexture, TEXTURE_FILTER_BILINEAR);
+    SetTextureWrap(m_MaskTexture, TEXTURE_WRAP_CLAMP);
+
+    Image noise{ const_cast<unsigned char*>(assets.noisePixels.data()), NOISE_SIZE, NOISE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+    m_NoiseTexture = LoadTextureFromImage(noise);
+    SetTextureFilter(m_NoiseTexture, TEXTURE_FILTER_POINT);
+    SetTextureWrap(m_NoiseTexture, TEXTURE_WRAP_REPEAT);
+
+    m_Effects = ALL_EFFECTS;
+    Precompile(m_Effects);
+}
+
+void CrtPass::Precompile(unsigned int effects) {
+    GetVariant(effects);
+}
+
+void CrtPass::SetEffects(unsigned int effects) {
+    m_Effects = effects & ALL_EFFECTS;
+}
+
+void CrtPass::Update(float time) {
+    m_Flicker = 1.0f + std::sin(time * 10.0f) * 0.01f;
+
+    // R2 low-discrepancy sequence: consecutive offsets land far apart, so the noise never crawls
+    float step = std::floor(time * NOISE_STEPS_PER_SECOND);
+    m_NoiseOffset.x = step * 0.7548776662f - std::floor(step * 0.7548776662f);
+    m_NoiseOffset.y = step * 0.5698402910f - std::floor(step * 0.5698402910f);
+}
+
+void CrtPass::Draw(Texture2D scene) {
+    Variant& variant = GetVariant(m_Effects);
+
+    BeginShaderMode(variant.shader);
+
+    // Sampler bindings only last for one batch, so they are set every frame
+    SetShaderValueTexture(variant.shader, variant.maskLoc, m_MaskTexture);
+    SetShaderValueTexture(variant.shader, variant.noiseLoc, m_NoiseTexture);
+    SetShaderValue(variant.shader, variant.noiseOffsetLoc, &m_NoiseOffset, SHADER_UNIFORM_VEC2);
+    SetShaderValue(variant.shader, variant.flickerLoc, &m_Flicker, SHADER_UNIFORM_FLOAT);
+
+    // Draw texture flipped vertically because of OpenGL coordinates, stretched to the screen
+    DrawTexturePro(
+        scene,
+        Rectangle{ 0, 0, static_cast<float>(scene.width), static_cast<float>(-scene.height) },
+        Rectangle{ 0, 0, static_cast<float>(m_ScreenWidth), static_cast<float>(m_ScreenHeight) },
+        Vector2{ 0, 0 },
+        0.0f,
+        WHITE);
+
+    EndShaderMode();
+}
+
+void CrtPass::Unload() {
+    if (!IsWindowReady()) {
+        m_Variants.clear();
+        return;
+    }
+
+    for (Variant& variant : m_Variants) {
+        UnloadShader(variant.shader);
+    }
+    m_Variants.clear();
+
+    if (m_MaskTexture.id != 0) UnloadTexture(m_MaskTexture);
+    if (m_NoiseTexture.id != 0) UnloadTexture(m_NoiseTexture);
+    m_MaskTexture = Texture2D{};
+    m_NoiseTexture = Texture2D{};
+}
+
+CrtPass::Variant& CrtPass::GetVariant(unsigned int effects) {
+    for (Variant& variant : m_Variants) {
+        if (variant.effects == effects) return variant;
+    }
+
+    std::string code = GLSL_VERSION;
+    if (effects & CHROMATIC_ABERRATION) code += "#define CRT_CHROMATIC_ABERRATION\n";
+    if (effects & SCANLINES)            code += "#define CRT_SCANLINES\n";
+    if (effects & NOISE)                code += "#define CRT_NOISE\n";
+    if (effects & VIGNETTE)             code += "#define CRT_VIGNETTE\n";
+    code += m_Source;
+
+    Variant variant{};
+    variant.effects = effects;
+    variant.shader = m_ShaderCache ? m_ShaderCache->Load(nullptr, code.c_str()) : LoadShaderFromMemory(nullptr, code.c_str());
+    variant.resolutionLoc = GetShaderLocation(variant.shader, "resolution");
+    variant.maskLoc = GetShaderLocation(variant.shader, "maskLut");
+    variant.noiseLoc = GetShaderLocation(variant.shader, "blueNoise");
+    variant.noiseOffsetLoc = GetShaderLocation(variant.shader, "noiseOffset");
+    variant.flickerLoc = GetShaderLocation(variant.shader, "flicker");
+
+    float resolution[2] = { static_cast<float>(m_ScreenWidth), static_cast<float>(m_ScreenHeight) };
+    SetShaderValue(variant.shader, variant.resolutionLoc, resolution, SHADER_UNIFORM_VEC2);
+
+    m_Variants.push_back(variant);
+    return m_Variants.back();
+}
+
+std::vector<unsigned char> CrtPass::GenerateMask(int screenHeight) {
+    // Gray + alpha: the shader reads the scanline factor from .r and the vignette from .a
+    std::vector<unsigned char> pixels(static_cast<size_t>(MASK_WIDTH) * screenHeight * 2);
+
+    for (int row = 0; row < screenHeight; ++row) {
+        float line = std::sin((row + 0.5f) * 2.0f) * 0.5f + 0.5f;
+        float scanline = 1.0f - line * 0.15f;
+        float v = (row + 0.5f) / screenHeight - 0.5f;
+
+        for (int column = 0; column < MASK_WIDTH; ++column) {
+            float u = (column + 0.5f) / MASK_WIDTH - 0.5f;
+            float t = std::clamp((std::sqrt(u * u + v * v) - 0.3f) / 0.5f, 0.0f, 1.0f);
+            float vignette = 1.0f - t * t * (3.0f - 2.0f * t) * 0.3f; // smoothstep(0.3, 0.8, dist)
+
+            size_t index = (static_cast<size_t>(row) * MASK_WIDTH + column) * 2;
+            pixels[index] = static_cast<unsigned char>(std::lround(scanline * 255.0f));
+            pixels[index + 1] = static_cast<unsigned char>(std::lround(vignette * 255.0f));
+        }
+    }
+
+    return pixels;
+}
+
+std::vector<unsigned char> CrtPass::GenerateBlueNoise(int size) {
+    const int count = size * size;
+    const float sigma = 1.5f;
+
+    // Toroidal Gaussian, indexed by wrapped (dx, dy), so the tile repeats seamlessly
+    std::vector<float> kernel(count);
+    for (int dy = 0; dy < size; ++dy) {
+        for (int dx = 0; dx < size; ++dx) {
+            int wx = std::min(dx, size - dx);
+            int wy = std::min(dy, size - dy);
+            kernel[dy * size + dx] = std::exp(-static_cast<float>(wx * wx + wy * wy) / (2.0f * sigma * sigma));
+        }
+    }
+
+    std::vector<uint8_t> pattern(count, 0);
+    std::vector<float> energy(count, 0.0f);
+    auto splat = [&](std::vector<float>& field, int index, float sign) {
+        int px = index % size;
+        int py = index / size;
+        for (int y = 0; y < size; ++y) {
+            const float* row = &kernel[((y - py + size) % size) * size];
+            float* out = &field[y * size];
+            // Split at px so both halves are straight loops (no modulo per texel)
+            for (int x = 0; x < px; ++x) out[x] += sign * row[x - px + size];
+            for (int x = px; x < size; ++x) out[x] += sign * row[x - px];
+        }
+    };
+    auto tightestCluster = [&](const std::vector<uint8_t>& bits, const std::vector<float>& field) {
+        int best = -1;
+        for (int i = 0; i < count; ++i) {
+            if (bits[i] && (best < 0 || field[i] > field[best])) best = i;
+        }
+        return best;
+    };
+    auto largestVoid = [&](const std::vector<uint8_t>& bits, const std::vector<float>& field) {
+        int best = -1;
+        for (int i = 0; i < count; ++i) {
+            if (!bits[i] && (best < 0 || field[i] < field[best])) best = i;
+        }
+        return best;
+    };
+
+    // Initial pattern: a tenth of the texels, fixed seed so the tile is the same every run
+    uint32_t state = 0x9E3779B9u;
+    int ones = 0;
+    while (ones < count / 10) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int index = static_cast<int>(state % static_cast<uint32_t>(count));
+        if (pattern[index]) continue;
+        pattern[index] = 1;
+        splat(energy, index, 1.0f);
+        ++ones;
+    }
+
+    // Relax: move the tightest cluster into the largest void until nothing moves
+    for (int iteration = 0; iteration < count; ++iteration) {
+        int cluster = tightestCluster(pattern, energy);
+        pattern[cluster] = 0;
+        splat(energy, cluster, -1.0f);
+
+        int hole = largestVoid(pattern, energy);
+        pattern[hole] = 1;
+        splat(energy, hole, 1.0f);
+        if (hole == cluster) break;
+    }
+
+    std::vector<int> rank(count, 0);
+
+    // Ranks below the initial count: remove clusters one by one
+    std::vector<uint8_t> bits = pattern;
+    std::vector<float> field = energy;
+    for (int r = ones - 1; r >= 0; --r) {
+        int cluster = tightestCluster(bits, field);
+        bits[cluster] = 0;
+        splat(field, cluster, -1.0f);
+        rank[cluster] = r;
+    }
+
+    // Remaining ranks: fill voids one by one (past half, this equals the tightest cluster of zeros)
+    for (int r = ones; r < count; ++r) {
+        int hole = largestVoid(pattern, energy);
+        pattern[hole] = 1;
+        splat(energy, hole, 1.0f);
+        rank[hole] = r;
+    }
+
+    std::vector<unsigned char> pixels(count);
+    for (int i = 0; i < count; ++i) {
+        pixels[i] = static_cast<unsigned char>(rank[i] * 256 / count);
+    }
+    return pixels;
+}
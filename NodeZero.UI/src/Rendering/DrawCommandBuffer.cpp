@@ -0,0 +1,307 @@
+#include "Rendering/DrawCommandBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+// Sort key layout: [layer:8][texture id:32][primitive:8]
+static uint64_t MakeKey(DrawLayer layer, unsigned int textureId, unsigned char primitive) {
+    return (static_cast<uint64_t>(layer) << 40) | (static_cast<uint64_t>(textureId) << 8) | primitive;
+}
+
+// Layer bits do not affect GPU state, only texture and primitive do
+static constexpr uint64_t STATE_MASK = (1ull << 40) - 1;
+
+DrawCommandBuffer::DrawCommandBuffer() {
+    m_Commands.reserve(INITIAL_COMMAND_CAPACITY);
+    m_Keys.reserve(INITIAL_COMMAND_CAPACITY);
+    m_Order.reserve(INITIAL_COMMAND_CAPACITY);
+}
+
+void DrawCommandBuffer::Begin(IRenderBackend& target) {
+    m_Target = &target;
+    m_Layer = DrawLayer::Reflection;
+    m_Offset = Vector2{ 0.0f, 0.0f };
+    m_OffsetStack.clear();
+    m_Anchored = false;
+    m_Anchor = Vector2{ 0.0f, 0.0f };
+    m_DrawCallCount = 0;
+    m_UnsortedDrawCallCount = 0;
+}
+
+void DrawCommandBuffer::SetLayer(DrawLayer layer) {
+    m_Layer = layer;
+}
+
+void DrawCommandBuffer::BeginAnchored() {
+    m_Anchored = true;
+}
+
+void DrawCommandBuffer::EndAnchored() {
+    m_Anchored = false;
+}
+
+void DrawCommandBuffer::SetAnchor(Vector2 anchor) {
+    m_Anchor = anchor;
+}
+
+void DrawCommandBuffer::Submit() {
+    if (m_Commands.empty() || !m_Target) {
+        m_Commands.clear();
+        m_Keys.clear();
+        m_Anchor = Vector2{ 0.0f, 0.0f };
+        return;
+    }
+
+    m_Order.resize(m_Commands.size());
+    std::iota(m_Order.begin(), m_Order.end(), 0u);
+    m_UnsortedDrawCallCount += CountDrawCalls(m_Keys, m_Order);
+
+    // Stable: equal keys keep their recorded (painter's) order
+    std::stable_sort(m_Order.begin(), m_Order.end(),
+        [this](uint32_t left, uint32_t right) { return m_Keys[left] < m_Keys[right]; });
+    m_DrawCallCount += CountDrawCalls(m_Keys, m_Order);
+
+    bool translated = false;
+    Vector2 currentOffset{ 0.0f, 0.0f };
+
+    for (uint32_t index : m_Order) {
+        const DrawCommand& command = m_Commands[index];
+
+        // Translations are applied to vertices on the CPU, so changing them does not flush
+        Vector2 offset = command.offset;
+        if (command.anchored) {
+            offset.x += m_Anchor.x;
+            offset.y += m_Anchor.y;
+        }
+
+        if (offset.x != currentOffset.x || offset.y != currentOffset.y) {
+            if (translated) m_Target->PopMatrix();
+            m_Target->PushMatrix();
+            m_Target->Translate(offset.x, offset.y);
+            translated = true;
+            currentOffset = offset;
+        }
+
+        Replay(command);
+    }
+
+    if (translated) m_Target->PopMatrix();
+
+    m_Commands.clear();
+    m_Keys.clear();
+    m_ColorVertices.clear();
+    m_TextureVertices.clear();
+    m_Text.clear();
+    m_Anchor = Vector2{ 0.0f, 0.0f };
+}
+
+int DrawCommandBuffer::GetDrawCallCount() const {
+    return m_DrawCallCount;
+}
+
+int DrawCommandBuffer::GetUnsortedDrawCallCount() const {
+    return m_UnsortedDrawCallCount;
+}
+
+int DrawCommandBuffer::CountDrawCalls(const std::vector<uint64_t>& keys, const std::vector<uint32_t>& order) {
+    int drawCalls = 0;
+    bool first = true;
+    uint64_t currentState = 0;
+
+    for (uint32_t index : order) {
+        uint64_t state = keys[index] & STATE_MASK;
+        if (first || state != currentState) {
+            ++drawCalls;
+            currentState = state;
+            first = false;
+        }
+    }
+
+    return drawCalls;
+}
+
+// -----------------------------------------------------------------------------
+// Forwarded Queries and Barriers
+// -----------------------------------------------------------------------------
+
+int DrawCommandBuffer::GetScreenWidth() const {
+    return m_Target ? m_Target->GetScreenWidth() : 0;
+}
+
+int DrawCommandBuffer::GetScreenHeight() const {
+    return m_Target ? m_Target->GetScreenHeight() : 0;
+}
+
+int DrawCommandBuffer::GetFPS() const {
+    return m_Target ? m_Target->GetFPS() : 0;
+}
+
+Vector2 DrawCommandBuffer::MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const {
+    return m_Target ? m_Target->MeasureTextEx(font, text, fontSize, spacing) : Vector2{ 0.0f, 0.0f };
+}
+
+void DrawCommandBuffer::BeginTextureMode(RenderTexture2D target) {
+    Submit();
+    if (m_Target) m_Target->BeginTextureMode(target);
+}
+
+void DrawCommandBuffer::EndTextureMode() {
+    Submit();
+    if (m_Target) m_Target->EndTextureMode();
+}
+
+void DrawCommandBuffer::ClearBackground(Color color) {
+    Submit();
+    if (m_Target) m_Target->ClearBackground(color);
+}
+
+void DrawCommandBuffer::PushMatrix() {
+    m_OffsetStack.push_back(m_Offset);
+}
+
+void DrawCommandBuffer::Translate(float x, float y) {
+    m_Offset.x += x;
+    m_Offset.y += y;
+}
+
+void DrawCommandBuffer::PopMatrix() {
+    if (!m_OffsetStack.empty()) {
+        m_Offset = m_OffsetStack.back();
+        m_OffsetStack.pop_back();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Recorded Draws
+// -----------------------------------------------------------------------------
+
+void DrawCommandBuffer::Record(const DrawCommand& command, Primitive primitive, unsigned int textureId) {
+    m_Commands.push_back(command);
+    m_Commands.back().offset = m_Offset;
+    m_Commands.back().anchored = m_Anchored;
+    m_Keys.push_back(MakeKey(m_Layer, textureId, static_cast<unsigned char>(primitive)));
+}
+
+void DrawCommandBuffer::DrawTriangles(const ColorVertex* vertices, int vertexCount) {
+    if (vertexCount <= 0) return;
+
+    DrawCommand command{};
+    command.type = CommandType::Triangles;
+    command.dataOffset = static_cast<int>(m_ColorVertices.size());
+    command.dataCount = vertexCount;
+    m_ColorVertices.insert(m_ColorVertices.end(), vertices, vertices + vertexCount);
+
+    Record(command, Primitive::Triangles, 0);
+}
+
+void DrawCommandBuffer::DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) {
+    if (vertexCount <= 0) return;
+
+    DrawCommand command{};
+    command.type = CommandType::TexturedQuads;
+    command.texture = texture;
+    command.dataOffset = static_cast<int>(m_TextureVertices.size());
+    command.dataCount = vertexCount;
+    m_TextureVertices.insert(m_TextureVertices.end(), vertices, vertices + vertexCount);
+
+    Record(command, Primitive::Quads, texture.id);
+}
+
+void DrawCommandBuffer::DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) {
+    DrawCommand command{};
+    command.type = CommandType::TextureRec;
+    command.texture = texture;
+    command.rect = source;
+    command.a = position;
+    command.color = tint;
+
+    Record(command, Primitive::Quads, texture.id);
+}
+
+void DrawCommandBuffer::DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    DrawCommand command{};
+    command.type = CommandType::Rectangle;
+    command.rect = Rectangle{ static_cast<float>(posX), static_cast<float>(posY), static_cast<float>(width), static_cast<float>(height) };
+    command.color = color;
+
+    Record(command, Primitive::Quads, 0);
+}
+
+void DrawCommandBuffer::DrawRectangleLines(int posX, int posY, int width, int height, Color color) {
+    DrawCommand command{};
+    command.type = CommandType::RectangleLines;
+    command.rect = Rectangle{ static_cast<float>(posX), static_cast<float>(posY), static_cast<float>(width), static_cast<float>(height) };
+    command.color = color;
+
+    Record(command, Primitive::Lines, 0);
+}
+
+void DrawCommandBuffer::DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) {
+    DrawCommand command{};
+    command.type = CommandType::LineEx;
+    command.a = start;
+    command.b = end;
+    command.size = thickness;
+    command.color = color;
+
+    Record(command, Primitive::Triangles, 0);
+}
+
+void DrawCommandBuffer::DrawCircleV(Vector2 center, float radius, Color color) {
+    DrawCommand command{};
+    command.type = CommandType::CircleV;
+    command.a = center;
+    command.size = radius;
+    command.color = color;
+
+    Record(command, Primitive::Quads, 0);
+}
+
+void DrawCommandBuffer::DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) {
+    int length = static_cast<int>(std::strlen(text));
+
+    DrawCommand command{};
+    command.type = CommandType::TextEx;
+    command.font = font;
+    command.a = position;
+    command.size = fontSize;
+    command.spacing = spacing;
+    command.color = color;
+    command.dataOffset = static_cast<int>(m_Text.size());
+    command.dataCount = length;
+    m_Text.insert(m_Text.end(), text, text + length + 1); // Keep the terminator
+
+    Record(command, Primitive::Quads, font.texture.id);
+}
+
+void DrawCommandBuffer::Replay(const DrawCommand& command) {
+    const Rectangle& rect = command.rect;
+
+    switch (command.type) {
+    case CommandType::Triangles:
+        m_Target->DrawTriangles(&m_ColorVertices[command.dataOffset], command.dataCount);
+        break;
+    case CommandType::TexturedQuads:
+        m_Target->DrawTexturedQuads(command.texture, &m_TextureVertices[command.dataOffset], command.dataCount);
+        break;
+    case CommandType::TextureRec:
+        m_Target->DrawTextureRec(command.texture, rect, command.a, command.color);
+        break;
+    case CommandType::Rectangle:
+        m_Target->DrawRectangle(static_cast<int>(rect.x), static_cast<int>(rect.y), static_cast<int>(rect.width), static_cast<int>(rect.height), command.color);
+        break;
+    case CommandType::RectangleLines:
+        m_Target->DrawRectangleLines(static_cast<int>(rect.x), static_cast<int>(rect.y), static_cast<int>(rect.width), static_cast<int>(rect.height), command.color);
+        break;
+    case CommandType::LineEx:
+        m_Target->DrawLineEx(command.a, command.b, command.size, command.color);
+        break;
+    case CommandType::CircleV:
+        m_Target->DrawCircleV(command.a, command.size, command.color);
+        break;
+    case CommandType::TextEx:
+        m_Target->DrawTextEx(command.font, &m_Text[command.dataOffset], command.a, command.size, command.spacing, command.color);
+        break;
+    }
+}
@@ -0,0 +1,81 @@
+#include "Rendering/DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+DynamicResolution::DynamicResolution(float frameBudget)
+    : m_FrameBudget(frameBudget),
+    m_AverageFrameTime(frameBudget),
+    m_TimeSinceChange(0.0f),
+    m_ProbeDelay(INITIAL_PROBE_DELAY),
+    m_IsProbing(false),
+    m_Step(0),
+    m_IsAutomatic(true) {
+}
+
+void DynamicResolution::Update(float frameTime) {
+    m_AverageFrameTime += (frameTime - m_AverageFrameTime) * SMOOTHING;
+    m_TimeSinceChange += frameTime;
+
+    if (!m_IsAutomatic || m_TimeSinceChange < MIN_TIME_BETWEEN_STEPS) {
+        return;
+    }
+
+    if (m_AverageFrameTime > m_FrameBudget * MISS_TOLERANCE) {
+        // A probe that misses straight away makes the next one wait longer
+        if (m_IsProbing) {
+            m_ProbeDelay = std::min(m_ProbeDelay * 2.0f, MAX_PROBE_DELAY);
+        }
+        StepDown();
+    }
+    else if (m_TimeSinceChange >= m_ProbeDelay) {
+        // The budget held long enough; a passed probe keeps the current delay
+        m_IsProbing = false;
+        StepUp();
+    }
+}
+
+void DynamicResolution::SetFixedScale(float scale) {
+    m_TimeSinceChange = 0.0f;
+    m_IsProbing = false;
+    m_ProbeDelay = INITIAL_PROBE_DELAY;
+    m_AverageFrameTime = m_FrameBudget;
+
+    if (scale <= AUTOMATIC) {
+        m_IsAutomatic = true;
+        return;
+    }
+
+    m_IsAutomatic = false;
+    int nearest = 0;
+    for (int i = 1; i < STEP_COUNT; ++i) {
+        if (std::fabs(STEPS[i] - scale) < std::fabs(STEPS[nearest] - scale)) {
+            nearest = i;
+        }
+    }
+    m_Step = nearest;
+}
+
+bool DynamicResolution::IsAutomatic() const {
+    return m_IsAutomatic;
+}
+
+float DynamicResolution::GetScale() const {
+    return STEPS[m_Step];
+}
+
+void DynamicResolution::StepDown() {
+    m_IsProbing = false;
+    m_TimeSinceChange = 0.0f;
+    if (m_Step < STEP_COUNT - 1) {
+        ++m_Step;
+    }
+}
+
+void DynamicResolution::StepUp() {
+    m_TimeSinceChange = 0.0f;
+    if (m_Step > 0) {
+        --m_Step;
+        m_IsProbing = true;
+    }
+}
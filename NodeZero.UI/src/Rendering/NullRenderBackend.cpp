@@ -0,0 +1,29 @@
+#include "Rendering/NullRenderBackend.h"
+
+#include <cstring>
+
+NullRenderBackend::NullRenderBackend(int screenWidth, int screenHeight)
+    : m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight) {
+}
+
+int NullRenderBackend::GetScreenWidth() const {
+    return m_ScreenWidth;
+}
+
+int NullRenderBackend::GetScreenHeight() const {
+    return m_ScreenHeight;
+}
+
+int NullRenderBackend::GetFPS() const {
+    return 0;
+}
+
+Vector2 NullRenderBackend::MeasureTextEx(Font /*font*/, const char* text, float fontSize, float spacing) const {
+    int length = static_cast<int>(std::strlen(text));
+    if (length == 0) {
+        return Vector2{ 0.0f, fontSize };
+    }
+
+    float width = length * fontSize * GLYPH_ADVANCE_RATIO + (length - 1) * spacing;
+    return Vector2{ width, fontSize };
+}
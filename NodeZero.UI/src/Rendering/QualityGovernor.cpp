@@ -0,0 +1,93 @@
+#include "Rendering/QualityGovernor.h"
+
+#include <algorithm>
+
+QualityGovernor::QualityGovernor(float frameBudget)
+    : m_FrameBudget(frameBudget) {
+}
+
+void QualityGovernor::Update(float frameTime, bool canRaise) {
+    m_Samples[m_NextSample] = frameTime;
+    m_NextSample = (m_NextSample + 1) % WINDOW_SIZE;
+    m_SampleCount = std::min(m_SampleCount + 1, WINDOW_SIZE);
+    m_TimeSinceStep += frameTime;
+
+    // Judge a tier only on frames rendered with it
+    if (m_SampleCount < WINDOW_SIZE) {
+        return;
+    }
+
+    m_Percentile = ComputePercentile();
+    int tier = static_cast<int>(m_Tier);
+
+    if (m_Percentile > m_FrameBudget * DOWN_THRESHOLD) {
+        m_HealthyTime = 0.0f;
+        if (tier + 1 < static_cast<int>(QualityTier::Count)) {
+            // Dropping back before the raised tier was held as long as it took to earn it
+            if (m_LastStepWasRaise && m_TimeSinceStep < m_UpHold) {
+                m_UpHold = std::min(m_UpHold * 2.0f, MAX_UP_HOLD);
+            }
+            StepTo(static_cast<QualityTier>(tier + 1));
+            m_LastStepWasRaise = false;
+        }
+    }
+    else if (m_Percentile < m_FrameBudget * UP_THRESHOLD) {
+        m_HealthyTime += frameTime;
+        if (canRaise && tier > 0 && m_HealthyTime >= m_UpHold) {
+            StepTo(static_cast<QualityTier>(tier - 1));
+            m_LastStepWasRaise = true;
+        }
+    }
+    else {
+        // Inside the hysteresis band: neither raise nor drop
+        m_HealthyTime = 0.0f;
+    }
+}
+
+QualityTier QualityGovernor::GetTier() const {
+    return m_Tier;
+}
+
+bool QualityGovernor::IsLowestTier() const {
+    return static_cast<int>(m_Tier) == static_cast<int>(QualityTier::Count) - 1;
+}
+
+float QualityGovernor::GetPercentileFrameTime() const {
+    return m_Percentile;
+}
+
+const QualityStep& QualityGovernor::GetLastStep() const {
+    return m_LastStep;
+}
+
+bool QualityGovernor::HasStepped() const {
+    return m_HasStepped;
+}
+
+const char* QualityGovernor::GetTierName(QualityTier tier) {
+    switch (tier) {
+    case QualityTier::Full:            return "Full";
+    case QualityTier::NoReflections:   return "No reflections";
+    case QualityTier::ReducedBloom:    return "Reduced bloom";
+    case QualityTier::CappedParticles: return "Capped particles";
+    case QualityTier::SimpleCrt:       return "Simple CRT";
+    default:                           return "Unknown";
+    }
+}
+
+void QualityGovernor::StepTo(QualityTier tier) {
+    m_LastStep = QualityStep{ m_Tier, tier, m_Percentile };
+    m_HasStepped = true;
+    m_Tier = tier;
+
+    m_TimeSinceStep = 0.0f;
+    m_HealthyTime = 0.0f;
+    m_SampleCount = 0;
+}
+
+float QualityGovernor::ComputePercentile() {
+    m_Scratch = m_Samples;
+    auto nth = m_Scratch.begin() + static_cast<int>(PERCENTILE * (WINDOW_SIZE - 1));
+    std::nth_element(m_Scratch.begin(), nth, m_Scratch.end());
+    return *nth;
+}
@@ -0,0 +1,156 @@
+#include "Rendering/RaylibRenderBackend.h"
+
+#include <algorithm>
+
+#include "rlgl.h"
+
+// Forward calls to global Raylib functions
+
+int RaylibRenderBackend::GetScreenWidth() const {
+    return ::GetScreenWidth();
+}
+
+int RaylibRenderBackend::GetScreenHeight() const {
+    return ::GetScreenHeight();
+}
+
+int RaylibRenderBackend::GetFPS() const {
+    return ::GetFPS();
+}
+
+void RaylibRenderBackend::BeginTextureMode(RenderTexture2D target) {
+    ResetShader();
+    ::BeginTextureMode(target);
+}
+
+void RaylibRenderBackend::EndTextureMode() {
+    ResetShader();
+    ::EndTextureMode();
+}
+
+void RaylibRenderBackend::ClearBackground(Color color) {
+    ::ClearBackground(color);
+}
+
+void RaylibRenderBackend::PushMatrix() {
+    rlPushMatrix();
+}
+
+void RaylibRenderBackend::Translate(float x, float y) {
+    rlTranslatef(x, y, 0.0f);
+}
+
+void RaylibRenderBackend::PopMatrix() {
+    rlPopMatrix();
+}
+
+void RaylibRenderBackend::DrawTriangles(const ColorVertex* vertices, int vertexCount) {
+    SelectShader(0);
+    const int totalTriangles = vertexCount / 3;
+    int triangle = 0;
+
+    while (triangle < totalTriangles) {
+        int blockTriangles = std::min(MAX_TRIANGLES_PER_BLOCK, totalTriangles - triangle);
+        rlCheckRenderBatchLimit(blockTriangles * 3);
+
+        rlBegin(RL_TRIANGLES);
+        for (int i = triangle * 3; i < (triangle + blockTriangles) * 3; ++i) {
+            const ColorVertex& vertex = vertices[i];
+            rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+            rlVertex2f(vertex.x, vertex.y);
+        }
+        rlEnd();
+
+        triangle += blockTriangles;
+    }
+}
+
+void RaylibRenderBackend::DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) {
+    if (texture.id == 0) {
+        return;
+    }
+
+    SelectShader(texture.id);
+
+    const int totalQuads = vertexCount / 4;
+    int quad = 0;
+
+    rlSetTexture(texture.id);
+    while (quad < totalQuads) {
+        int blockQuads = std::min(MAX_QUADS_PER_BLOCK, totalQuads - quad);
+        rlCheckRenderBatchLimit(blockQuads * 4);
+
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        for (int i = quad * 4; i < (quad + blockQuads) * 4; ++i) {
+            const TextureVertex& vertex = vertices[i];
+            rlColor4ub(vertex.color.r, vertex.color.g, vertex.color.b, vertex.color.a);
+            rlTexCoord2f(vertex.u, vertex.v);
+            rlVertex2f(vertex.x, vertex.y);
+        }
+        rlEnd();
+
+        quad += blockQuads;
+    }
+    rlSetTexture(0);
+}
+
+void RaylibRenderBackend::DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) {
+    SelectShader(texture.id);
+    ::DrawTextureRec(texture, source, position, tint);
+}
+
+void RaylibRenderBackend::DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    SelectShader(0);
+    ::DrawRectangle(posX, posY, width, height, color);
+}
+
+void RaylibRenderBackend::DrawRectangleLines(int posX, int posY, int width, int height, Color color) {
+    SelectShader(0);
+    ::DrawRectangleLines(posX, posY, width, height, color);
+}
+
+void RaylibRenderBackend::DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) {
+    SelectShader(0);
+    ::DrawLineEx(start, end, thickness, color);
+}
+
+void RaylibRenderBackend::DrawCircleV(Vector2 center, float radius, Color color) {
+    SelectShader(0);
+    ::DrawCircleV(center, radius, color);
+}
+
+Vector2 RaylibRenderBackend::MeasureTextEx(Font font, const char* text, float fontSize, float spacing) const {
+    return ::MeasureTextEx(font, text, fontSize, spacing);
+}
+
+void RaylibRenderBackend::DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) {
+    SelectShader(font.texture.id);
+    ::DrawTextEx(font, text, position, fontSize, spacing, color);
+}
+
+void RaylibRenderBackend::SetTextShader(Texture2D fontAtlas, Shader shader) {
+    ResetShader();
+    m_TextAtlasId = fontAtlas.id;
+    m_TextShader = shader;
+}
+
+void RaylibRenderBackend::SelectShader(unsigned int textureId) {
+    bool wantText = m_TextAtlasId != 0 && textureId == m_TextAtlasId;
+    if (wantText == m_TextShaderActive) {
+        return;
+    }
+
+    // Switching shaders flushes the batch, so only do it on a font/non-font transition
+    if (wantText) {
+        ::BeginShaderMode(m_TextShader);
+    }
+    else {
+        ::EndShaderMode();
+    }
+    m_TextShaderActive = wantText;
+}
+
+void RaylibRenderBackend::ResetShader() {
+    SelectShader(0);
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "Rendering/RecordingRenderBackend.h"
+
+RecordingRenderBackend::RecordingRenderBackend(int screenWidth, int screenHeight)
+    : NullRenderBackend(screenWidth, screenHeight) {
+}
+
+void RecordingRenderBackend::Reset() {
+    m_Stats = RenderStats{};
+    m_CurrentMode = PrimitiveMode::None;
+    m_CurrentTexture = 0;
+    m_BatchVertices = 0;
+    m_BatchDrawCalls = 0;
+}
+
+const RenderStats& RecordingRenderBackend::GetStats() const {
+    return m_Stats;
+}
+
+void RecordingRenderBackend::BeginTextureMode(RenderTexture2D target) {
+    Flush();
+}
+
+void RecordingRenderBackend::EndTextureMode() {
+    Flush();
+}
+
+void RecordingRenderBackend::DrawTriangles(const ColorVertex* vertices, int vertexCount) {
+    Record(PrimitiveMode::Triangles, 0, vertexCount);
+}
+
+void RecordingRenderBackend::DrawTexturedQuads(Texture2D texture, const TextureVertex* vertices, int vertexCount) {
+    Record(PrimitiveMode::Quads, texture.id, vertexCount);
+}
+
+void RecordingRenderBackend::DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint) {
+    Record(PrimitiveMode::Quads, texture.id, 4);
+}
+
+void RecordingRenderBackend::DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    Record(PrimitiveMode::Quads, 0, RECTANGLE_VERTICES);
+}
+
+void RecordingRenderBackend::DrawRectangleLines(int posX, int posY, int width, int height, Color color) {
+    Record(PrimitiveMode::Lines, 0, RECTANGLE_LINES_VERTICES);
+}
+
+void RecordingRenderBackend::DrawLineEx(Vector2 start, Vector2 end, float thickness, Color color) {
+    Record(PrimitiveMode::Triangles, 0, LINE_EX_VERTICES);
+}
+
+void RecordingRenderBackend::DrawCircleV(Vector2 center, float radius, Color color) {
+    Record(PrimitiveMode::Quads, 0, CIRCLE_VERTICES);
+}
+
+void RecordingRenderBackend::DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color color) {
+    // One textured quad per visible codepoint (UTF-8 continuation bytes and whitespace emit nothing)
+    int glyphs = 0;
+    for (const char* c = text; *c != '\0'; ++c) {
+        unsigned char byte = static_cast<unsigned char>(*c);
+        bool isContinuation = (byte & 0xC0) == 0x80;
+        bool isWhitespace = byte == ' ' || byte == '\t' || byte == '\n';
+        if (!isContinuation && !isWhitespace) ++glyphs;
+    }
+
+    Record(PrimitiveMode::Quads, font.texture.id, glyphs * 4);
+}
+
+void RecordingRenderBackend::Record(PrimitiveMode mode, unsigned int textureId, int vertexCount) {
+    if (vertexCount <= 0) {
+        return;
+    }
+
+    if (m_BatchVertices + vertexCount > BATCH_VERTEX_CAPACITY) {
+        Flush();
+    }
+
+    bool textureChanged = textureId != m_CurrentTexture;
+    bool modeChanged = mode != m_CurrentMode;
+
+    if (m_CurrentMode == PrimitiveMode::None || textureChanged || modeChanged) {
+        if (m_CurrentMode != PrimitiveMode::None) {
+            if (textureChanged) m_Stats.textureChanges++;
+            if (modeChanged) m_Stats.modeChanges++;
+        }
+
+        if (m_BatchDrawCalls >= BATCH_DRAW_CALL_CAPACITY) {
+            Flush();
+        }
+
+        m_Stats.drawCalls++;
+        m_BatchDrawCalls++;
+        m_CurrentMode = mode;
+        m_CurrentTexture = textureId;
+    }
+
+    m_BatchVertices += vertexCount;
+    m_Stats.vertices += vertexCount;
+}
+
+void RecordingRenderBackend::Flush() {
+    if (m_BatchVertices > 0) {
+        m_Stats.flushes++;
+    }
+
+    m_BatchVertices = 0;
+    m_BatchDrawCalls = 0;
+    m_CurrentMode = PrimitiveMode::None;
+}
@@ -0,0 +1,107 @@
+#include "Rendering/RenderBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "Game.h"
+#include "Renderer.h"
+#include "Rendering/RecordingRenderBackend.h"
+#include "Screens/GameplayScreen.h"
+#include "Simulation/SimulationThread.h"
+
+int RenderBenchmark::Run(int frames) {
+    if (frames <= 0) {
+        std::cerr << "render-bench: frame count must be positive" << std::endl;
+        return 1;
+    }
+
+    RecordingRenderBackend recorder(SCREEN_WIDTH, SCREEN_HEIGHT);
+    Renderer::SetBackend(&recorder);
+
+    Game game;
+    game.Initialize(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT));
+    game.Reset();
+
+    // Stepped on this thread, one tick per frame, so runs stay deterministic
+    SimulationThread simulation(game, 1.0f / FRAME_DELTA_TIME);
+
+    // No GPU resources exist headless. The handles only serve as batching keys, so give
+    // each texture a distinct fake id to see the same texture switches as a real run.
+    std::vector<GlyphInfo> glyphs(FAKE_FONT_GLYPH_COUNT);
+    std::vector<Rectangle> glyphRecs(FAKE_FONT_GLYPH_COUNT);
+    float glyphWidth = FAKE_FONT_BASE_SIZE / 2.0f;
+    for (int i = 0; i < FAKE_FONT_GLYPH_COUNT; ++i) {
+        glyphs[i].value = FAKE_FONT_FIRST_CHAR + i;
+        glyphs[i].advanceX = static_cast<int>(glyphWidth);
+        glyphRecs[i] = Rectangle{ i * glyphWidth, 0.0f, glyphWidth, static_cast<float>(FAKE_FONT_BASE_SIZE) };
+    }
+
+    Font font{};
+    font.texture.id = FAKE_FONT_TEXTURE_ID;
+    font.texture.width = static_cast<int>(FAKE_FONT_GLYPH_COUNT * glyphWidth);
+    font.texture.height = FAKE_FONT_BASE_SIZE;
+    font.baseSize = FAKE_FONT_BASE_SIZE;
+    font.glyphCount = FAKE_FONT_GLYPH_COUNT;
+    font.glyphs = glyphs.data();
+    font.recs = glyphRecs.data();
+    Texture2D glowTexture{};
+    glowTexture.id = FAKE_GLOW_TEXTURE_ID;
+    Texture2D particleTexture{};
+    particleTexture.id = FAKE_PARTICLE_TEXTURE_ID;
+    RenderTexture2D nodeLayer{};
+    nodeLayer.texture.id = FAKE_NODE_LAYER_TEXTURE_ID;
+
+    auto screen = std::make_shared<GameplayScreen>(simulation, [](GameScreen) {}, font, glowTexture, particleTexture, nodeLayer);
+
+    // The screen's own Update is not used: it would read the real mouse and keyboard.
+
+    RenderStats totals;
+    RenderStats worst;
+    double totalMicroseconds = 0.0;
+    double worstMicroseconds = 0.0;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        // Keep the damage zone on the spawn target so nodes, particles and pickups all get exercised
+        // (Draw() late-latches the real cursor into the slot, so it is set again every frame)
+        simulation.SetMousePosition(SCREEN_WIDTH / 2.0f, SCREEN_HEIGHT / 2.0f);
+        simulation.Step();
+        screen->UpdateEffects(FRAME_DELTA_TIME);
+
+        recorder.Reset();
+        auto start = std::chrono::steady_clock::now();
+
+        screen->RenderOffscreen();
+        screen->Draw();
+
+        auto end = std::chrono::steady_clock::now();
+        double microseconds = std::chrono::duration<double, std::micro>(end - start).count();
+        totalMicroseconds += microseconds;
+        worstMicroseconds = std::max(worstMicroseconds, microseconds);
+
+        const RenderStats& stats = recorder.GetStats();
+        totals.drawCalls += stats.drawCalls;
+        totals.vertices += stats.vertices;
+        totals.textureChanges += stats.textureChanges;
+        totals.modeChanges += stats.modeChanges;
+        totals.flushes += stats.flushes;
+
+        worst.drawCalls = std::max(worst.drawCalls, stats.drawCalls);
+        worst.vertices = std::max(worst.vertices, stats.vertices);
+        worst.flushes = std::max(worst.flushes, stats.flushes);
+    }
+
+    Renderer::SetBackend(nullptr);
+
+    std::cout << "Render benchmark: " << frames << " frames at " << SCREEN_WIDTH << "x" << SCREEN_HEIGHT
+        << " (peak nodes " << game.GetPeakNodeCount() << ")\n";
+    std::cout << "  CPU prepare   avg " << totalMicroseconds / frames << " us, worst " << worstMicroseconds << " us\n";
+    std::cout << "  Draw calls    avg " << static_cast<double>(totals.drawCalls) / frames << ", worst " << worst.drawCalls << "\n";
+    std::cout << "  Vertices      avg " << static_cast<double>(totals.vertices) / frames << ", worst " << worst.vertices << "\n";
+    std::cout << "  State changes avg " << static_cast<double>(totals.GetStateChanges()) / frames << "\n";
+    std::cout << "  Flushes       avg " << static_cast<double>(totals.flushes) / frames << ", worst " << worst.flushes << std::endl;
+
+    return 0;
+}
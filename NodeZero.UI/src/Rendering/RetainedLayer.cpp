@@ -0,0 +1,92 @@
+#include "Rendering/RetainedLayer.h"
+
+#include <cmath>
+
+#include "Renderer.h"
+#include "rlgl.h"
+
+RetainedLayer::~RetainedLayer() {
+    Unload();
+}
+
+void RetainedLayer::Begin() {
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+
+    if (m_Target.id == 0 || m_Target.texture.width != width || m_Target.texture.height != height) {
+        Unload();
+        m_Target = LoadRenderTexture(width, height);
+        SetTextureWrap(m_Target.texture, TEXTURE_WRAP_CLAMP);
+    }
+
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.BeginTextureMode(m_Target);
+    backend.ClearBackground(BLANK);
+    BeginPremultiplied();
+    m_HasContent = true;
+}
+
+void RetainedLayer::BeginRegion(Rectangle region) {
+    if (!IsValid()) {
+        Begin();
+        return;
+    }
+
+    // Whole pixels, grown outwards so anti-aliased edges are cleared too
+    int left = static_cast<int>(std::floor(region.x)) - 1;
+    int top = static_cast<int>(std::floor(region.y)) - 1;
+    int right = static_cast<int>(std::ceil(region.x + region.width)) + 1;
+    int bottom = static_cast<int>(std::ceil(region.y + region.height)) + 1;
+
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.BeginTextureMode(m_Target);
+    BeginScissorMode(left, top, right - left, bottom - top);
+    backend.ClearBackground(BLANK); // glClear honors the scissor rectangle
+    BeginPremultiplied();
+    m_InRegion = true;
+}
+
+void RetainedLayer::End() {
+    EndBlendMode();
+    if (m_InRegion) {
+        EndScissorMode();
+        m_InRegion = false;
+    }
+    Renderer::GetBackend().EndTextureMode();
+}
+
+void RetainedLayer::Draw() const {
+    if (!m_HasContent || m_Target.id == 0) return;
+
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    // Flipped vertically because of OpenGL texture coordinates
+    Renderer::GetBackend().DrawTextureRec(
+        m_Target.texture,
+        Rectangle{ 0, 0, static_cast<float>(m_Target.texture.width), static_cast<float>(-m_Target.texture.height) },
+        Vector2{ 0, 0 },
+        WHITE);
+    EndBlendMode();
+}
+
+bool RetainedLayer::IsValid() const {
+    return m_HasContent && m_Target.id != 0 &&
+        m_Target.texture.width == GetScreenWidth() && m_Target.texture.height == GetScreenHeight();
+}
+
+void RetainedLayer::Invalidate() {
+    m_HasContent = false;
+}
+
+void RetainedLayer::Unload() {
+    // The GL context may already be gone when a screen outlives the window
+    if (m_Target.id != 0 && IsWindowReady()) {
+        UnloadRenderTexture(m_Target);
+    }
+    m_Target = RenderTexture2D{};
+    m_HasContent = false;
+}
+
+void RetainedLayer::BeginPremultiplied() {
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
@@ -0,0 +1,165 @@
+#include "Rendering/SdfFont.h"
+
+#include <fstream>
+#include <iostream>
+
+/** @brief Writes one fixed-size value in native byte order (the cache never leaves the machine). */
+template <typename T>
+static void WriteValue(std::ofstream& file, T value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool ReadValue(std::ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+SdfFont::Data SdfFont::LoadData(const unsigned char* fontData, int fontDataSize, const std::string& cacheDirectory) {
+    if (fontData == nullptr || fontDataSize <= 0) {
+        return Data{};
+    }
+
+    std::string atlasPath = cacheDirectory + ATLAS_FILE_NAME;
+    std::string metricsPath = cacheDirectory + METRICS_FILE_NAME;
+    CacheHeader header = MakeHeader(fontData, fontDataSize);
+
+    Data data{};
+    if (LoadFromCache(atlasPath, metricsPath, header, data)) {
+        return data;
+    }
+
+    return Bake(fontData, fontDataSize, atlasPath, metricsPath, header);
+}
+
+Font SdfFont::Upload(Data& data) {
+    if (data.atlas.data == nullptr) {
+        return Font{};
+    }
+
+    Font font = data.font;
+    font.texture = LoadTextureFromImage(data.atlas);
+    UnloadImage(data.atlas);
+    data = Data{};
+
+    // Distance fields must be interpolated, not snapped
+    SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+    return font;
+}
+
+SdfFont::CacheHeader SdfFont::MakeHeader(const unsigned char* fontData, int fontDataSize) {
+    CacheHeader header{};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.baseSize = BASE_SIZE;
+    header.glyphPadding = GLYPH_PADDING;
+    header.glyphCount = GLYPH_COUNT;
+    header.sourceSize = fontDataSize;
+
+    // A few hundred KB once per start; far cheaper than the bake it can save
+    uint64_t hash = 14695981039346656037ull;
+    for (int i = 0; i < fontDataSize; ++i) {
+        hash = (hash ^ fontData[i]) * 1099511628211ull;
+    }
+    header.sourceHash = hash;
+    return header;
+}
+
+bool SdfFont::LoadFromCache(const std::string& atlasPath, const std::string& metricsPath, const CacheHeader& expected, Data& data) {
+    std::ifstream file(metricsPath, std::ios::binary);
+    if (!file.is_open() || !FileExists(atlasPath.c_str())) {
+        return false;
+    }
+
+    CacheHeader header{};
+    bool headerRead = ReadValue(file, header.magic) && ReadValue(file, header.version) &&
+        ReadValue(file, header.baseSize) && ReadValue(file, header.glyphPadding) &&
+        ReadValue(file, header.glyphCount) && ReadValue(file, header.sourceSize) &&
+        ReadValue(file, header.sourceHash);
+
+    if (!headerRead || header.magic != expected.magic || header.version != expected.version ||
+        header.baseSize != expected.baseSize || header.glyphPadding != expected.glyphPadding ||
+        header.glyphCount != expected.glyphCount || header.sourceSize != expected.sourceSize ||
+        header.sourceHash != expected.sourceHash) {
+        return false;
+    }
+
+    // Allocated with raylib's allocator so UnloadFont() can free them
+    GlyphInfo* glyphs = static_cast<GlyphInfo*>(MemAlloc(sizeof(GlyphInfo) * header.glyphCount));
+    Rectangle* recs = static_cast<Rectangle*>(MemAlloc(sizeof(Rectangle) * header.glyphCount));
+
+    bool glyphsRead = true;
+    for (int i = 0; i < header.glyphCount && glyphsRead; ++i) {
+        glyphsRead = ReadValue(file, glyphs[i].value) && ReadValue(file, glyphs[i].offsetX) &&
+            ReadValue(file, glyphs[i].offsetY) && ReadValue(file, glyphs[i].advanceX) &&
+            ReadValue(file, recs[i].x) && ReadValue(file, recs[i].y) &&
+            ReadValue(file, recs[i].width) && ReadValue(file, recs[i].height);
+    }
+
+    Image atlas = glyphsRead ? LoadImage(atlasPath.c_str()) : Image{};
+    if (atlas.data == nullptr) {
+        MemFree(glyphs);
+        MemFree(recs);
+        return false;
+    }
+
+    data.font.baseSize = header.baseSize;
+    data.font.glyphCount = header.glyphCount;
+    data.font.glyphPadding = header.glyphPadding;
+    data.font.glyphs = glyphs;
+    data.font.recs = recs;
+    data.atlas = atlas;
+    return true;
+}
+
+SdfFont::Data SdfFont::Bake(const unsigned char* fontData, int fontDataSize, const std::string& atlasPath, const std::string& metricsPath, const CacheHeader& header) {
+    Font font{};
+    font.baseSize = BASE_SIZE;
+    font.glyphCount = GLYPH_COUNT;
+    font.glyphs = LoadFontData(fontData, fontDataSize, BASE_SIZE, nullptr, GLYPH_COUNT, FONT_SDF);
+
+    if (font.glyphs == nullptr) {
+        return Data{};
+    }
+
+    Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, GLYPH_COUNT, BASE_SIZE, GLYPH_PADDING, PACK_SKYLINE);
+    font.glyphPadding = GLYPH_PADDING;
+
+    // A failed write only costs a re-bake on the next start
+    if (ExportImage(atlas, atlasPath.c_str())) {
+        WriteMetrics(metricsPath, header, font);
+    }
+    else {
+        std::cerr << "SdfFont: could not write atlas cache to " << atlasPath << std::endl;
+    }
+
+    Data data{};
+    data.font = font;
+    data.atlas = atlas;
+    return data;
+}
+
+void SdfFont::WriteMetrics(const std::string& metricsPath, const CacheHeader& header, const Font& font) {
+    std::ofstream file(metricsPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return;
+    }
+
+    WriteValue(file, header.magic);
+    WriteValue(file, header.version);
+    WriteValue(file, header.baseSize);
+    WriteValue(file, header.glyphPadding);
+    WriteValue(file, header.glyphCount);
+    WriteValue(file, header.sourceSize);
+    WriteValue(file, header.sourceHash);
+
+    for (int i = 0; i < font.glyphCount; ++i) {
+        WriteValue(file, font.glyphs[i].value);
+        WriteValue(file, font.glyphs[i].offsetX);
+        WriteValue(file, font.glyphs[i].offsetY);
+        WriteValue(file, font.glyphs[i].advanceX);
+        WriteValue(file, font.recs[i].x);
+        WriteValue(file, font.recs[i].y);
+        WriteValue(file, font.recs[i].width);
+        WriteValue(file, font.recs[i].height);
+    }
+}
@@ -0,0 +1,203 @@
+#include "Rendering/ShaderCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "rlgl.h"
+
+#if defined(_WIN32)
+#define SHADER_CACHE_APIENTRY __stdcall
+#else
+#define SHADER_CACHE_APIENTRY
+#endif
+
+// GLFW's loader, linked in with raylib; it also resolves GL 1.1 entry points on Windows
+extern "C" {
+typedef void (*GLFWglproc)(void);
+GLFWglproc glfwGetProcAddress(const char* procname);
+}
+
+namespace {
+
+// GL enums used here (rlgl keeps its GL headers private)
+constexpr unsigned int GL_ENUM_VENDOR = 0x1F00;
+constexpr unsigned int GL_ENUM_RENDERER = 0x1F01;
+constexpr unsigned int GL_ENUM_VERSION = 0x1F02;
+constexpr unsigned int GL_ENUM_LINK_STATUS = 0x8B82;
+constexpr unsigned int GL_ENUM_PROGRAM_BINARY_LENGTH = 0x8741;
+constexpr unsigned int GL_ENUM_NUM_PROGRAM_BINARY_FORMATS = 0x87FE;
+
+/** @brief FNV-1a, continued from `hash` so several strings can be chained. */
+uint64_t HashString(const char* text, uint64_t hash = 14695981039346656037ull) {
+    for (const char* c = text; c != nullptr && *c != '\0'; ++c) {
+        hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+    }
+    // Separator, so ("ab", "c") and ("a", "bc") differ
+    return (hash ^ 0xFFu) * 1099511628211ull;
+}
+
+template <typename Function>
+Function LoadFunction(const char* name) {
+    return reinterpret_cast<Function>(glfwGetProcAddress(name));
+}
+
+} // namespace
+
+struct ShaderCache::GlFunctions {
+    const unsigned char* (SHADER_CACHE_APIENTRY* getString)(unsigned int name);
+    void (SHADER_CACHE_APIENTRY* getIntegerv)(unsigned int name, int* data);
+    unsigned int (SHADER_CACHE_APIENTRY* createProgram)();
+    void (SHADER_CACHE_APIENTRY* getProgramiv)(unsigned int program, unsigned int name, int* params);
+    void (SHADER_CACHE_APIENTRY* getProgramBinary)(unsigned int program, int bufSize, int* length, unsigned int* binaryFormat, void* binary);
+    void (SHADER_CACHE_APIENTRY* programBinary)(unsigned int program, unsigned int binaryFormat, const void* binary, int length);
+};
+
+ShaderCache::ShaderCache(const std::string& cacheDirectory)
+    : m_Directory(cacheDirectory),
+    m_Gl(std::make_unique<GlFunctions>()) {
+    m_Gl->getString = LoadFunction<decltype(m_Gl->getString)>("glGetString");
+    m_Gl->getIntegerv = LoadFunction<decltype(m_Gl->getIntegerv)>("glGetIntegerv");
+    m_Gl->createProgram = LoadFunction<decltype(m_Gl->createProgram)>("glCreateProgram");
+    m_Gl->getProgramiv = LoadFunction<decltype(m_Gl->getProgramiv)>("glGetProgramiv");
+    m_Gl->getProgramBinary = LoadFunction<decltype(m_Gl->getProgramBinary)>("glGetProgramBinary");
+    m_Gl->programBinary = LoadFunction<decltype(m_Gl->programBinary)>("glProgramBinary");
+
+    if (!m_Gl->getString || !m_Gl->getIntegerv || !m_Gl->createProgram || !m_Gl->getProgramiv ||
+        !m_Gl->getProgramBinary || !m_Gl->programBinary) {
+        return;
+    }
+
+    int formatCount = 0;
+    m_Gl->getIntegerv(GL_ENUM_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    m_Supported = formatCount > 0;
+
+    // A driver update invalidates every binary, so the driver's identity is part of the key.
+    // So is raylib's, whose default vertex shader is linked into programs without their own.
+    uint64_t hash = HashString(reinterpret_cast<const char*>(m_Gl->getString(GL_ENUM_VENDOR)));
+    hash = HashString(reinterpret_cast<const char*>(m_Gl->getString(GL_ENUM_RENDERER)), hash);
+    hash = HashString(reinterpret_cast<const char*>(m_Gl->getString(GL_ENUM_VERSION)), hash);
+    m_DriverHash = HashString(RAYLIB_VERSION, hash);
+}
+
+ShaderCache::~ShaderCache() = default;
+
+Shader ShaderCache::Load(const char* vsCode, const char* fsCode) {
+    if (!m_Supported) {
+        return LoadShaderFromMemory(vsCode, fsCode);
+    }
+
+    CacheHeader header{};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.sourceHash = HashString(fsCode, HashString(vsCode));
+    header.driverHash = m_DriverHash;
+
+    // One file per source: a driver update overwrites the stale binary instead of adding one
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(header.sourceHash));
+    std::string path = m_Directory + FILE_PREFIX + name + FILE_EXTENSION;
+
+    unsigned int program = LoadBinary(path, header);
+    if (program != 0) {
+        return MakeShader(program);
+    }
+
+    // A failed compile falls back to raylib's default shader, which is not worth caching
+    Shader shader = LoadShaderFromMemory(vsCode, fsCode);
+    if (shader.id != 0 && shader.id != rlGetShaderIdDefault()) {
+        SaveBinary(path, header, shader.id);
+    }
+    return shader;
+}
+
+unsigned int ShaderCache::LoadBinary(const std::string& path, const CacheHeader& expected) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    // Native layout: the cache never leaves the machine
+    CacheHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != expected.magic || header.version != expected.version ||
+        header.sourceHash != expected.sourceHash || header.driverHash != expected.driverHash ||
+        header.binaryLength <= 0) {
+        return 0;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(header.binaryLength));
+    if (!file.read(binary.data(), header.binaryLength)) {
+        return 0;
+    }
+
+    unsigned int program = m_Gl->createProgram();
+    m_Gl->programBinary(program, header.binaryFormat, binary.data(), header.binaryLength);
+
+    int linked = 0;
+    m_Gl->getProgramiv(program, GL_ENUM_LINK_STATUS, &linked);
+    if (!linked) {
+        std::cerr << "ShaderCache: driver rejected " << path << ", compiling from source" << std::endl;
+        rlUnloadShaderProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void ShaderCache::SaveBinary(const std::string& path, CacheHeader header, unsigned int program) {
+    int length = 0;
+    m_Gl->getProgramiv(program, GL_ENUM_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    int written = 0;
+    unsigned int format = 0;
+    m_Gl->getProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return;
+    }
+
+    header.binaryFormat = format;
+    header.binaryLength = written;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+    if (!file) {
+        std::cerr << "ShaderCache: could not write " << path << std::endl;
+    }
+}
+
+Shader ShaderCache::MakeShader(unsigned int program) {
+    Shader shader{};
+    shader.id = program;
+
+    // Same allocation as raylib's, so UnloadShader() frees it
+    shader.locs = static_cast<int*>(MemAlloc(RL_MAX_SHADER_LOCATIONS * sizeof(int)));
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; ++i) {
+        shader.locs[i] = -1;
+    }
+
+    // Attribute bindings are part of the linked binary; the locations are looked up as raylib does
+    shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(program, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+
+    shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+
+    shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+    shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1);
+    shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(program, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+    return shader;
+}
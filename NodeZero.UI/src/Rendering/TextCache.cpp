@@ -0,0 +1,158 @@
+#include "Rendering/TextCache.h"
+
+#include <cstring>
+#include <functional>
+
+// raylib's default line spacing (SetTextLineSpacing is never called)
+static constexpr float TEXT_LINE_SPACING = 2.0f;
+
+// -----------------------------------------------------------------------------
+// TextRun
+// -----------------------------------------------------------------------------
+
+void TextRun::Build(const char* text, Font font, float fontSize, float spacing) {
+    m_Text = text;
+    m_Font = font;
+    m_FontSize = fontSize;
+    m_Spacing = spacing;
+    m_Size = MeasureTextEx(font, text, fontSize, spacing);
+    m_Quads.clear();
+    m_Position = Vector2{ 0.0f, 0.0f };
+    m_Tint = WHITE;
+
+    m_UseFallback = font.texture.id == 0 || font.glyphs == nullptr || font.recs == nullptr;
+    if (m_UseFallback) return;
+
+    // Mirrors DrawTextEx + DrawTextCodepoint, but stores the quads instead of drawing them
+    float scale = fontSize / font.baseSize;
+    float padding = static_cast<float>(font.glyphPadding);
+    float textureWidth = static_cast<float>(font.texture.width);
+    float textureHeight = static_cast<float>(font.texture.height);
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    int length = static_cast<int>(std::strlen(text));
+    for (int i = 0; i < length;) {
+        int byteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &byteCount);
+        int index = GetGlyphIndex(font, codepoint);
+        i += byteCount;
+
+        if (codepoint == '\n') {
+            offsetY += fontSize + TEXT_LINE_SPACING;
+            offsetX = 0.0f;
+            continue;
+        }
+
+        const GlyphInfo& glyph = font.glyphs[index];
+        const Rectangle& rec = font.recs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            float left = offsetX + (glyph.offsetX - padding) * scale;
+            float top = offsetY + (glyph.offsetY - padding) * scale;
+            float right = left + (rec.width + 2.0f * padding) * scale;
+            float bottom = top + (rec.height + 2.0f * padding) * scale;
+
+            float u0 = (rec.x - padding) / textureWidth;
+            float v0 = (rec.y - padding) / textureHeight;
+            float u1 = (rec.x + rec.width + padding) / textureWidth;
+            float v1 = (rec.y + rec.height + padding) / textureHeight;
+
+            m_Quads.push_back(TextureVertex{ left, top, u0, v0, m_Tint });
+            m_Quads.push_back(TextureVertex{ left, bottom, u0, v1, m_Tint });
+            m_Quads.push_back(TextureVertex{ right, bottom, u1, v1, m_Tint });
+            m_Quads.push_back(TextureVertex{ right, top, u1, v0, m_Tint });
+        }
+
+        float advance = glyph.advanceX == 0 ? rec.width : static_cast<float>(glyph.advanceX);
+        offsetX += advance * scale + spacing;
+    }
+}
+
+void TextRun::Draw(IRenderBackend& backend, Vector2 position, Color tint) {
+    if (m_UseFallback) {
+        backend.DrawTextEx(m_Font, m_Text.c_str(), position, m_FontSize, m_Spacing, tint);
+        return;
+    }
+    if (m_Quads.empty()) return;
+
+    // Static HUD text keeps both, so the usual draw touches no vertex at all
+    if (position.x != m_Position.x || position.y != m_Position.y) {
+        float deltaX = position.x - m_Position.x;
+        float deltaY = position.y - m_Position.y;
+        for (TextureVertex& vertex : m_Quads) {
+            vertex.x += deltaX;
+            vertex.y += deltaY;
+        }
+        m_Position = position;
+    }
+
+    if (tint.r != m_Tint.r || tint.g != m_Tint.g || tint.b != m_Tint.b || tint.a != m_Tint.a) {
+        for (TextureVertex& vertex : m_Quads) {
+            vertex.color = tint;
+        }
+        m_Tint = tint;
+    }
+
+    backend.DrawTexturedQuads(m_Font.texture, m_Quads.data(), static_cast<int>(m_Quads.size()));
+}
+
+bool TextRun::Matches(const char* text, Font font, float fontSize, float spacing) const {
+    return fontSize == m_FontSize && spacing == m_Spacing && SameFont(font, m_Font) && m_Text == text;
+}
+
+Vector2 TextRun::GetSize() const {
+    return m_Size;
+}
+
+const std::string& TextRun::GetText() const {
+    return m_Text;
+}
+
+bool TextRun::SameFont(Font left, Font right) {
+    return left.texture.id == right.texture.id && left.baseSize == right.baseSize && left.glyphs == right.glyphs;
+}
+
+// -----------------------------------------------------------------------------
+// TextCache
+// -----------------------------------------------------------------------------
+
+bool TextCache::Key::operator==(const Key& other) const {
+    return fontTexture == other.fontTexture && fontSize == other.fontSize && spacing == other.spacing && text == other.text;
+}
+
+size_t TextCache::KeyHash::operator()(const Key& key) const {
+    size_t hash = std::hash<std::string>{}(key.text);
+    hash ^= std::hash<unsigned int>{}(key.fontTexture) + 0x9E3779B9u + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<float>{}(key.fontSize) + 0x9E3779B9u + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<float>{}(key.spacing) + 0x9E3779B9u + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+TextRun& TextCache::Get(const char* text, Font font, float fontSize, float spacing) {
+    m_Lookup.text = text;
+    m_Lookup.fontTexture = font.texture.id;
+    m_Lookup.fontSize = fontSize;
+    m_Lookup.spacing = spacing;
+
+    auto it = m_Runs.find(m_Lookup);
+    if (it != m_Runs.end()) {
+        return it->second;
+    }
+
+    if (m_Runs.size() >= MAX_RUNS) {
+        m_Runs.clear();
+    }
+
+    TextRun& run = m_Runs[m_Lookup];
+    run.Build(text, font, fontSize, spacing);
+    return run;
+}
+
+void TextCache::Clear() {
+    m_Runs.clear();
+}
+
+size_t TextCache::GetSize() const {
+    return m_Runs.size();
+}
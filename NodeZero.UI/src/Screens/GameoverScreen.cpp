@@ -3,12 +3,13 @@
 #include <string>
 
 #include "Config/GameConfig.h"
+#include "Renderer.h"
 #include "Services/IPickupService.h"
 #include "Widgets/Button.h"
 #include "Widgets/Label.h"
 
 GameoverScreen::GameoverScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_Font(font) {
+    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_PointsLabel(nullptr), m_ShownPoints(-1), m_Font(font) {
     m_Menu = std::make_unique<Menu>();
 
     const int screenWidth = GetScreenWidth();
@@ -37,6 +38,11 @@ GameoverScreen::GameoverScreen(IGame& game, std::function<void(GameScreen)> stat
         RED);
     m_Menu->AddWidget(std::move(title));
 
+    // Points Label (text and position are set in RenderOffscreen)
+    auto pointsLabel = std::make_unique<Label>(0.0f, 0.0f, "", font, static_cast<int>(screenHeight * POINTS_FONT_RATIO), WHITE);
+    m_PointsLabel = pointsLabel.get();
+    m_Menu->AddWidget(std::move(pointsLabel));
+
     // Restart Button
     auto restartButton = std::make_unique<Button>(centerX, startY, buttonWidth, buttonHeight, "Restart Level", font);
     restartButton->SetColors(Color{ 50, 150, 50, 255 }, Color{ 80, 180, 80, 255 }, Color{ 30, 120, 30, 255 }, WHITE);
@@ -60,15 +66,25 @@ void GameoverScreen::Update(float deltaTime) {
     m_Menu->Update();
 }
 
-void GameoverScreen::Draw() {
-    DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Color{ 0, 0, 0, 200 });
-    m_Menu->Draw();
+void GameoverScreen::RenderOffscreen() {
+    // The label only changes (and gets repainted) when the points do
+    int points = m_Game.GetPickupService().GetPickupPoints();
+    if (points != m_ShownPoints) {
+        m_ShownPoints = points;
+
+        std::string pointsText = "Points: " + std::to_string(points);
+        int pointsFontSize = static_cast<int>(GetScreenHeight() * POINTS_FONT_RATIO);
+        Vector2 textSize = MeasureTextEx(m_Font, pointsText.c_str(), static_cast<float>(pointsFontSize), 1);
 
-    std::string pointsText = "Points: " + std::to_string(m_Game.GetPickupService().GetPickupPoints());
-    int pointsFontSize = static_cast<int>(GetScreenHeight() * POINTS_FONT_RATIO);
-    Vector2 textSize = MeasureTextEx(m_Font, pointsText.c_str(), static_cast<float>(pointsFontSize), 1);
+        m_PointsLabel->SetText(pointsText.c_str());
+        m_PointsLabel->SetPosition(GetScreenWidth() / 2.0f - textSize.x / 2.0f, GetScreenHeight() * POINTS_Y_RATIO);
+    }
 
-    DrawTextEx(m_Font, pointsText.c_str(),
-        Vector2{ GetScreenWidth() / 2.0f - textSize.x / 2.0f, GetScreenHeight() * POINTS_Y_RATIO },
-        static_cast<float>(pointsFontSize), 1, WHITE);
+    m_Menu->RenderOffscreen();
+}
+
+void GameoverScreen::Draw() {
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.DrawRectangle(0, 0, backend.GetScreenWidth(), backend.GetScreenHeight(), Color{ 0, 0, 0, 200 });
+    m_Menu->Draw();
 }
\ No newline at end of file
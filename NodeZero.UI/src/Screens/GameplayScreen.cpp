@@ -2,38 +2,42 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
 
-#include "Events/GameEvents.h"
-#include "INode.h"
+#include "Collision/NodeBounds.h"
 #include "InputHandler.h"
 #include "Renderer.h"
-#include "Services/IHealthService.h"
-#include "Services/ILevelService.h"
-#include "Services/IPickupService.h"
-#include "Services/IUpgradeService.h"
+#include "Simulation/SimulationThread.h"
 #include "raylib.h"
 #include "raymath.h"
-#include "rlgl.h"
 
-GameplayScreen::GameplayScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_Font(font)
+GameplayScreen::GameplayScreen(SimulationThread& simulation, std::function<void(GameScreen)> stateChangeCallback, Font font,
+    Texture2D glowTexture, Texture2D particleTexture, RenderTexture2D nodeLayer)
+    : m_Simulation(simulation), m_StateChangeCallback(stateChangeCallback), m_Font(font), m_NodeLayer(nodeLayer)
     , m_ShakeIntensity(0.0f), m_ShakeDuration(0.0f), m_ShakeTimer(0.0f), m_ShakeOffset{ 0.0f, 0.0f } {
-    m_DamageParticles.reserve(MAX_PARTICLES);
+    m_GlowBatch.SetTexture(glowTexture);
+    m_ParticleBatch.SetTexture(particleTexture);
     m_PickupEffects.reserve(MAX_PICKUP_EFFECTS);
 }
 
-void GameplayScreen::Update(const std::shared_ptr<IEvent>& event) {
-    auto gameEvent = std::static_pointer_cast<GameEvent>(event);
-    if (gameEvent->type == EventType::NodeDamaged) {
+void GameplayScreen::HandleEvent(const GameEvent& event) {
+    if (event.type == EventType::NodeDamaged) {
         TriggerShake(SHAKE_INTENSITY, SHAKE_DURATION);
 
-        Position nodePos = gameEvent->position;
+        Position nodePos = event.position;
         Vector2 particlePos = { nodePos.x, nodePos.y };
         SpawnDamageParticles(particlePos, RED, PARTICLE_COUNT);
     }
 
-    if (gameEvent->type == EventType::GameOver) {
+    if (event.type == EventType::PickupCollected && m_PickupEffects.size() < MAX_PICKUP_EFFECTS) {
+        PickupCollectEffect effect{};
+        effect.startPosition = Vector2{ event.position.x, event.position.y };
+        effect.elapsed = 0.0f;
+        effect.duration = PICKUP_COLLECT_EFFECT_DURATION;
+        effect.size = event.size;
+        m_PickupEffects.push_back(effect);
+    }
+
+    if (event.type == EventType::GameOver) {
         // Explicitly clear all effects to stop particles/shake on death
         ClearEffects();
     }
@@ -52,8 +56,8 @@ void GameplayScreen::UpdateShake(float deltaTime) {
         float progress = m_ShakeTimer / m_ShakeDuration;
         float currentIntensity = m_ShakeIntensity * (1.0f - progress);
 
-        float randomX = (static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f) * currentIntensity;
-        float randomY = (static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f) * currentIntensity;
+        float randomX = NextShakeRandom() * currentIntensity;
+        float randomY = NextShakeRandom() * currentIntensity;
 
         m_ShakeOffset = Vector2{ randomX, randomY };
     }
@@ -62,115 +66,133 @@ void GameplayScreen::UpdateShake(float deltaTime) {
     }
 }
 
+float GameplayScreen::NextShakeRandom() {
+    uint32_t x = m_ShakeRandomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_ShakeRandomState = x;
+
+    // Top 24 bits -> exactly representable float in [0, 1), then to [-1, 1)
+    return (x >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
 void GameplayScreen::SpawnDamageParticles(Vector2 position, Color baseColor, int count) {
-    if (m_DamageParticles.size() >= MAX_PARTICLES) {
-        return;
+    if (GetQualityTier() >= QualityTier::CappedParticles) {
+        if (m_Particles.GetCount() >= CAPPED_PARTICLE_LIMIT) return;
+        count = std::min(count, CAPPED_PARTICLE_COUNT);
     }
 
-    float screenScale = GetScreenHeight() / 800.0f; // Screen scaling factor for particle size
-    int particlesToSpawn = std::min(count, static_cast<int>(MAX_PARTICLES - m_DamageParticles.size()));
-
-    for (int i = 0; i < particlesToSpawn; ++i) {
-        DamageParticle particle;
-        particle.position = position;
+    IRenderBackend& backend = Renderer::GetBackend();
+    float screenScale = backend.GetScreenHeight() / 800.0f; // Screen scaling factor for particle size
+
+    // Refactor: Use constant for base size scaling
+    float baseSize = PARTICLE_BASE_SIZE_SCALING * screenScale;
+
+    ParticleBurst burst{};
+    burst.position = position;
+    burst.baseColor = baseColor;
+    burst.count = count;
+    burst.speedMin = PARTICLE_SPEED_MIN;
+    burst.speedMax = PARTICLE_SPEED_MAX;
+    burst.sizeMin = baseSize;
+    burst.sizeMax = baseSize * 2.0f;
+    burst.lifetime = PARTICLE_LIFETIME;
+    burst.colorVariance = PARTICLE_COLOR_VARIANCE;
+    m_Particles.Emit(burst);
+}
 
-        float angle = (static_cast<float>(rand()) / RAND_MAX) * 6.28318530718f;
-        float speed = PARTICLE_SPEED_MIN + (static_cast<float>(rand()) / RAND_MAX) * (PARTICLE_SPEED_MAX - PARTICLE_SPEED_MIN);
+void GameplayScreen::SetQualityGovernor(const QualityGovernor* governor) {
+    m_Governor = governor;
+}
 
-        particle.velocity.x = cos(angle) * speed;
-        particle.velocity.y = sin(angle) * speed;
+QualityTier GameplayScreen::GetQualityTier() const {
+    return m_Governor ? m_Governor->GetTier() : QualityTier::Full;
+}
 
-        particle.lifetime = 0.0f;
-        particle.maxLifetime = PARTICLE_LIFETIME;
+void GameplayScreen::ClearEffects() {
+    m_Particles.Clear();
+    m_PickupEffects.clear();
+    m_ShakeTimer = m_ShakeDuration;
+    m_ShakeOffset = Vector2{ 0.0f, 0.0f };
+}
 
-        // Refactor: Use constant for base size scaling
-        float baseSize = PARTICLE_BASE_SIZE_SCALING * screenScale;
-        particle.size = baseSize + (static_cast<float>(rand()) / RAND_MAX) * baseSize;
+bool GameplayScreen::IsVisible(float x, float y, float radius) const {
+    IRenderBackend& backend = Renderer::GetBackend();
 
-        // Refactor: Use constant for color variance
-        unsigned char r = baseColor.r + (rand() % (2 * PARTICLE_COLOR_VARIANCE)) - PARTICLE_COLOR_VARIANCE;
-        unsigned char g = baseColor.g + (rand() % (2 * PARTICLE_COLOR_VARIANCE)) - PARTICLE_COLOR_VARIANCE;
-        unsigned char b = baseColor.b + (rand() % (2 * PARTICLE_COLOR_VARIANCE)) - PARTICLE_COLOR_VARIANCE;
-        particle.color = Color{ r, g, b, 255 };
+    // Padded by the maximum shake so nothing pops in at the edges while shaking
+    float extent = radius + SHAKE_INTENSITY;
 
-        m_DamageParticles.push_back(particle);
-    }
+    return x + extent >= 0.0f && x - extent <= static_cast<float>(backend.GetScreenWidth()) &&
+        y + extent >= 0.0f && y - extent <= static_cast<float>(backend.GetScreenHeight());
 }
 
-void GameplayScreen::UpdateParticles(float deltaTime) {
-    size_t writeIndex = 0;
-    for (size_t readIndex = 0; readIndex < m_DamageParticles.size(); ++readIndex) {
-        auto& particle = m_DamageParticles[readIndex];
-
-        particle.lifetime += deltaTime;
+void GameplayScreen::DrawNodes(Span<const NodeRenderData> nodes) {
+    m_NodeBatch.Clear();
 
-        if (particle.lifetime < particle.maxLifetime) {
-            particle.position.x += particle.velocity.x * deltaTime;
-            particle.position.y += particle.velocity.y * deltaTime;
+    // Snapshots hold active nodes only
+    for (const NodeRenderData& node : nodes) {
+        if (!IsVisible(node.position.x, node.position.y, NodeBounds::GetRadius(node.shape, node.size))) continue;
 
-            // Refactor: Use constant for gravity/acceleration
-            particle.velocity.y += PARTICLE_GRAVITY * deltaTime;
+        float x = node.position.x;
+        float y = node.position.y;
+        float size = node.size;
+        float hpPercentage = node.hpRatio;
+        float rotation = node.rotation;
 
-            float lifeRatio = particle.lifetime / particle.maxLifetime;
-            particle.color.a = static_cast<unsigned char>((1.0f - lifeRatio) * 255.0f);
+        Color color = (node.shape == NodeShape::Boss) ? Color{ 200, 50, 200, 255 } : RED;
 
-            if (writeIndex != readIndex) {
-                m_DamageParticles[writeIndex] = particle;
-            }
-            ++writeIndex;
+        switch (node.shape) {
+        case NodeShape::Circle: Renderer::DrawCircleNode(m_NodeBatch, x, y, size, hpPercentage, color, rotation); break;
+        case NodeShape::Square: Renderer::DrawSquareNode(m_NodeBatch, x, y, size, hpPercentage, color, rotation); break;
+        case NodeShape::Hexagon: Renderer::DrawHexagonNode(m_NodeBatch, x, y, size, hpPercentage, color, rotation); break;
+        case NodeShape::Boss: Renderer::DrawSquareNode(m_NodeBatch, x, y, size, hpPercentage, color, rotation); break;
+        default: Renderer::DrawCircleNode(m_NodeBatch, x, y, size, hpPercentage, color, rotation); break;
         }
     }
 
-    m_DamageParticles.resize(writeIndex);
+    m_NodeBatch.Submit(Renderer::GetBackend());
 }
 
-void GameplayScreen::ClearEffects() {
-    m_DamageParticles.clear();
-    m_PickupEffects.clear();
-    m_ShakeTimer = m_ShakeDuration;
-    m_ShakeOffset = Vector2{ 0.0f, 0.0f };
+void GameplayScreen::RenderOffscreen() {
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.BeginTextureMode(m_NodeLayer);
+    backend.ClearBackground(BLANK);
+    DrawNodes(m_Simulation.GetSnapshot().nodes);
+    backend.EndTextureMode();
 }
 
-void GameplayScreen::DrawReflections(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset) {
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x + reflectionOffset;
-            float y = node->GetPosition().y + reflectionOffset;
-            float size = node->GetSize();
-            float hpPercentage = node->GetHP() / node->GetMaxHP();
-            float rotation = node->GetRotation();
-
-            Color reflectionColor = RED;
-            if (node->GetShape() == NodeShape::Boss) reflectionColor = Color{ 200, 50, 200, 255 };
-            reflectionColor.a = 5;
-
-            switch (node->GetShape()) {
-            case NodeShape::Circle: Renderer::DrawCircleNode(x, y, size, hpPercentage, reflectionColor, rotation); break;
-            case NodeShape::Square: Renderer::DrawSquareNode(x, y, size, hpPercentage, reflectionColor, rotation); break;
-            case NodeShape::Hexagon: Renderer::DrawHexagonNode(x, y, size, hpPercentage, reflectionColor, rotation); break;
-            case NodeShape::Boss: Renderer::DrawSquareNode(x, y, size, hpPercentage, reflectionColor, rotation); break;
-            default: Renderer::DrawCircleNode(x, y, size, hpPercentage, reflectionColor, rotation); break;
-            }
-        }
-    }
+void GameplayScreen::DrawNodeLayer(float offset, Color tint) {
+    IRenderBackend& backend = Renderer::GetBackend();
+
+    // Render textures are stored upside down (OpenGL), so flip the source rect
+    backend.DrawTextureRec(
+        m_NodeLayer.texture,
+        Rectangle{ 0, 0, static_cast<float>(m_NodeLayer.texture.width), static_cast<float>(-m_NodeLayer.texture.height) },
+        Vector2{ offset, offset },
+        tint);
+}
+
+void GameplayScreen::DrawZoneReflection(Vector2 mousePos, float damageZoneSize, float reflectionOffset) {
+    IRenderBackend& backend = Renderer::GetBackend();
 
     // Draw damage zone reflection
     float damageRectX = mousePos.x - damageZoneSize / 2.0f;
     float damageRectY = mousePos.y - damageZoneSize / 2.0f;
 
-    DrawRectangle(
+    backend.DrawRectangle(
         static_cast<int>(damageRectX + reflectionOffset),
         static_cast<int>(damageRectY + reflectionOffset),
         static_cast<int>(damageZoneSize),
         static_cast<int>(damageZoneSize),
-        Color{ 0, 100, 255, 5 });
+        Color{ 0, 100, 255, REFLECTION_ALPHA });
 
     // Draw reflection corners
-    float cornerLength = GetScreenHeight() * CORNER_LENGTH_RATIO;
-    float cornerThickness = GetScreenHeight() * CORNER_THICKNESS_RATIO;
+    float cornerLength = backend.GetScreenHeight() * CORNER_LENGTH_RATIO;
+    float cornerThickness = backend.GetScreenHeight() * CORNER_THICKNESS_RATIO;
     Color cornerColor = Color{ 0, 200, 255, 255 };
     Color reflectionCornerColor = cornerColor;
-    reflectionCornerColor.a = 5;
+    reflectionCornerColor.a = REFLECTION_ALPHA;
 
     float rLeft = damageRectX + reflectionOffset;
     float rRight = mousePos.x + damageZoneSize / 2 + reflectionOffset;
@@ -178,55 +200,65 @@ void GameplayScreen::DrawReflections(const std::vector<INode*>& nodes, Vector2 m
     float rBottom = mousePos.y + damageZoneSize / 2 + reflectionOffset;
 
     // Drawing all 8 reflection corner lines
-    DrawLineEx(Vector2{ rLeft, rTop }, Vector2{ rLeft + cornerLength, rTop }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rLeft, rTop }, Vector2{ rLeft, rTop + cornerLength }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rRight, rTop }, Vector2{ rRight - cornerLength, rTop }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rRight, rTop }, Vector2{ rRight, rTop + cornerLength }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rLeft, rBottom }, Vector2{ rLeft + cornerLength, rBottom }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rLeft, rBottom }, Vector2{ rLeft, rBottom - cornerLength }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rRight, rBottom }, Vector2{ rRight - cornerLength, rBottom }, cornerThickness, reflectionCornerColor);
-    DrawLineEx(Vector2{ rRight, rBottom }, Vector2{ rRight, rBottom - cornerLength }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rLeft, rTop }, Vector2{ rLeft + cornerLength, rTop }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rLeft, rTop }, Vector2{ rLeft, rTop + cornerLength }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rRight, rTop }, Vector2{ rRight - cornerLength, rTop }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rRight, rTop }, Vector2{ rRight, rTop + cornerLength }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rLeft, rBottom }, Vector2{ rLeft + cornerLength, rBottom }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rLeft, rBottom }, Vector2{ rLeft, rBottom - cornerLength }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rRight, rBottom }, Vector2{ rRight - cornerLength, rBottom }, cornerThickness, reflectionCornerColor);
+    backend.DrawLineEx(Vector2{ rRight, rBottom }, Vector2{ rRight, rBottom - cornerLength }, cornerThickness, reflectionCornerColor);
 }
 
-void GameplayScreen::DrawBloom(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize) {
-    // Draw bloom for nodes
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x;
-            float y = node->GetPosition().y;
-            float size = node->GetSize();
+void GameplayScreen::DrawBloom(Span<const NodeRenderData> nodes, Vector2 mousePos, float damageZoneSize) {
+    m_GlowBatch.Clear();
+
+    // Fill rate grows with the glow area, so the reduced tier shrinks the node glows
+    float radiusRatio = GetQualityTier() >= QualityTier::ReducedBloom ? REDUCED_BLOOM_RADIUS_RATIO : NODE_BLOOM_RADIUS_RATIO;
+
+    // Bloom for nodes
+    for (const NodeRenderData& node : nodes) {
+        float glowRadius = node.size * radiusRatio;
+        if (IsVisible(node.position.x, node.position.y, glowRadius)) {
+            Vector2 center = { node.position.x, node.position.y };
 
             Color glowColor = RED;
-            if (node->GetShape() == NodeShape::Boss) glowColor = Color{ 200, 50, 200, 255 };
+            if (node.shape == NodeShape::Boss) glowColor = Color{ 200, 50, 200, 255 };
+            glowColor.a = BLOOM_ALPHA;
 
-            glowColor.a = 40;
-            DrawCircleGradient(static_cast<int>(x), static_cast<int>(y), size * 2.0f, glowColor, Fade(glowColor, 0.0f));
+            m_GlowBatch.AddSprite(center, glowRadius, glowColor);
         }
     }
 
-    // Draw bloom for damage zone
-    Color zoneBloomColor = Color{ 0, 100, 255, 40 };
-    DrawCircleGradient(static_cast<int>(mousePos.x), static_cast<int>(mousePos.y), damageZoneSize * 0.8f, zoneBloomColor, Fade(zoneBloomColor, 0.0f));
+    m_GlowBatch.Submit(Renderer::GetBackend());
+
+    // Bloom for damage zone: its own command so it can follow the late-latched cursor.
+    // Same texture and layer, so it still lands in the node glows' draw call.
+    m_GlowBatch.Clear();
+    Color zoneBloomColor = Color{ 0, 100, 255, BLOOM_ALPHA };
+    m_GlowBatch.AddSprite(mousePos, damageZoneSize * ZONE_BLOOM_RADIUS_RATIO, zoneBloomColor);
+
+    m_Commands.BeginAnchored();
+    m_GlowBatch.Submit(Renderer::GetBackend());
+    m_Commands.EndAnchored();
 }
 
 void GameplayScreen::Update(float deltaTime) {
+    // The simulation thread picks this up at the start of its next tick
     Vector2 mousePos = InputHandler::GetMousePosition();
-    m_Game.SetMousePosition(mousePos.x, mousePos.y);
+    m_Simulation.SetMousePosition(mousePos.x, mousePos.y);
 
-    m_Game.Update(deltaTime);
+    UpdateEffects(deltaTime);
 
-    UpdateShake(deltaTime);
-    UpdateParticles(deltaTime);
-
-    // State Transitions
+    // State Transitions (the simulation has already stopped itself for the first two)
 
-    if (m_Game.GetHealthService().IsZero()) {
-        m_Game.SaveProgress();
+    const GameSnapshot& snapshot = m_Simulation.GetSnapshot();
+    if (snapshot.healthDepleted) {
         m_StateChangeCallback(GameScreen::GameOver);
         return;
     }
 
-    if (m_Game.GetLevelService().IsLevelCompleted()) {
+    if (snapshot.levelCompleted) {
         m_StateChangeCallback(GameScreen::LevelCompleted);
         return;
     }
@@ -234,22 +266,18 @@ void GameplayScreen::Update(float deltaTime) {
     if (IsKeyPressed(KEY_ESCAPE)) {
         m_StateChangeCallback(GameScreen::Paused);
     }
+}
 
-    // Pickup Effect Updates
+void GameplayScreen::UpdateEffects(float deltaTime) {
+    m_Simulation.AcquireSnapshot();
+    for (const GameEvent& event : m_Simulation.GetSnapshot().events) {
+        HandleEvent(event);
+    }
 
-    std::vector<PointPickup> collectedPickups = m_Game.GetCollectedPickupsThisFrame();
-    for (const PointPickup& pickup : collectedPickups) {
-        if (m_PickupEffects.size() >= MAX_PICKUP_EFFECTS) {
-            break;
-        }
+    UpdateShake(deltaTime);
+    m_Particles.Update(deltaTime);
 
-        PickupCollectEffect effect{};
-        effect.startPosition = Vector2{ pickup.position.x, pickup.position.y };
-        effect.elapsed = 0.0f;
-        effect.duration = PICKUP_COLLECT_EFFECT_DURATION;
-        effect.size = pickup.size;
-        m_PickupEffects.push_back(effect);
-    }
+    // Pickup Effect Updates
 
     size_t writeIndex = 0;
     for (size_t readIndex = 0; readIndex < m_PickupEffects.size(); ++readIndex) {
@@ -268,41 +296,51 @@ void GameplayScreen::Update(float deltaTime) {
 }
 
 void GameplayScreen::Draw() {
-    rlPushMatrix();
-    rlTranslatef(m_ShakeOffset.x, m_ShakeOffset.y, 0.0f);
+    // Record the whole frame, then replay it sorted by layer/texture/primitive
+    IRenderBackend& target = Renderer::GetBackend();
+    m_Commands.Begin(target);
+    Renderer::SetBackend(&m_Commands);
 
-    Vector2 mousePos = InputHandler::GetMousePosition();
-    float damageZoneSize = m_Game.GetUpgradeService().GetDamageZoneSize();
+    IRenderBackend& backend = m_Commands;
+    backend.PushMatrix();
+    backend.Translate(m_ShakeOffset.x, m_ShakeOffset.y);
+
+    const GameSnapshot& snapshot = m_Simulation.GetSnapshot();
+    const HudSnapshot& hud = snapshot.hud;
+
+    Vector2 mousePos = InputHandler::GetMousePosition(); // Pickup trails aim here
+    float damageZoneSize = hud.damageZoneSize;
 
-    const auto& nodes = m_Game.GetNodes();
+    // Cursor-relative draws are recorded around the origin as anchored commands and
+    // moved to a cursor position sampled right before Submit() (late latch)
+    const Vector2 cursor{ 0.0f, 0.0f };
+
+    const auto& nodes = snapshot.nodes;
 
     // Visual Effects
-    float reflectionOffset = GetScreenHeight() * REFLECTION_OFFSET_RATIO;
-    DrawReflections(nodes, mousePos, damageZoneSize, reflectionOffset);
-    DrawBloom(nodes, mousePos, damageZoneSize);
-
-    // Draw Nodes
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x;
-            float y = node->GetPosition().y;
-            float size = node->GetSize();
-            float hpPercentage = node->GetHP() / node->GetMaxHP();
-            float rotation = node->GetRotation();
-            Color baseColor = (node->GetShape() == NodeShape::Boss) ? Color{ 200, 50, 200, 255 } : RED;
-
-            switch (node->GetShape()) {
-            case NodeShape::Circle: Renderer::DrawCircleNode(x, y, size, hpPercentage, baseColor, rotation); break;
-            case NodeShape::Square: Renderer::DrawSquareNode(x, y, size, hpPercentage, baseColor, rotation); break;
-            case NodeShape::Hexagon: Renderer::DrawHexagonNode(x, y, size, hpPercentage, baseColor, rotation); break;
-            case NodeShape::Boss: Renderer::DrawSquareNode(x, y, size, hpPercentage, baseColor, rotation); break;
-            default: Renderer::DrawCircleNode(x, y, size, hpPercentage, baseColor, rotation); break;
-            }
-        }
+    // Reflections and bloom blend over each other with different textures, so each gets its
+    // own layer: sorting by texture must not change their painter's order
+    float reflectionOffset = backend.GetScreenHeight() * REFLECTION_OFFSET_RATIO;
+    if (GetQualityTier() < QualityTier::NoReflections) {
+        // Node reflections: the already rendered node layer, offset and nearly transparent
+        m_Commands.SetLayer(DrawLayer::Reflection);
+        DrawNodeLayer(reflectionOffset, Color{ 255, 255, 255, REFLECTION_ALPHA });
+
+        m_Commands.SetLayer(DrawLayer::ZoneReflection);
+        m_Commands.BeginAnchored();
+        DrawZoneReflection(cursor, damageZoneSize, reflectionOffset);
+        m_Commands.EndAnchored();
     }
+    m_Commands.SetLayer(DrawLayer::Bloom);
+    DrawBloom(nodes, cursor, damageZoneSize);
+
+    // Draw Nodes (rendered in RenderOffscreen)
+    m_Commands.SetLayer(DrawLayer::World);
+    DrawNodeLayer(0.0f, WHITE);
 
     // Draw Pickups
-    const auto& pickups = m_Game.GetPickupService().GetPickups();
+    m_Commands.SetLayer(DrawLayer::Effects);
+    const auto& pickups = snapshot.pickups;
     for (const PointPickup& pickup : pickups) {
         float lifeRatio = std::clamp(pickup.GetLifeRatio(), 0.0f, 1.0f);
         unsigned char alpha = static_cast<unsigned char>(lifeRatio * 255.0f);
@@ -333,16 +371,18 @@ void GameplayScreen::Draw() {
         Renderer::DrawPickup(currentPos.x, currentPos.y, effect.size, Color{ 255, 50, 50, alpha });
     }
 
-    // Draw Particles
-    for (const DamageParticle& particle : m_DamageParticles) {
-        DrawCircleV(particle.position, particle.size, particle.color);
-    }
+    // Draw Particles (one textured quad each, one draw call)
+    m_ParticleBatch.Clear();
+    m_Particles.Draw(m_ParticleBatch);
+    m_ParticleBatch.Submit(backend);
 
     // Draw Damage Zone
-    float damageRectX = mousePos.x - damageZoneSize / 2.0f;
-    float damageRectY = mousePos.y - damageZoneSize / 2.0f;
+    m_Commands.SetLayer(DrawLayer::Overlay);
+    m_Commands.BeginAnchored();
+    float damageRectX = cursor.x - damageZoneSize / 2.0f;
+    float damageRectY = cursor.y - damageZoneSize / 2.0f;
 
-    DrawRectangle(
+    backend.DrawRectangle(
         static_cast<int>(damageRectX),
         static_cast<int>(damageRectY),
         static_cast<int>(damageZoneSize),
@@ -350,52 +390,66 @@ void GameplayScreen::Draw() {
         Color{ 0, 100, 255, 80 });
 
     // Draw Damage Zone Corners
-    float cornerLength = GetScreenHeight() * CORNER_LENGTH_RATIO;
-    float cornerThickness = GetScreenHeight() * CORNER_THICKNESS_RATIO;
+    float cornerLength = backend.GetScreenHeight() * CORNER_LENGTH_RATIO;
+    float cornerThickness = backend.GetScreenHeight() * CORNER_THICKNESS_RATIO;
     Color cornerColor = Color{ 0, 200, 255, 255 };
 
     float left = damageRectX;
-    float right = mousePos.x + damageZoneSize / 2;
+    float right = cursor.x + damageZoneSize / 2;
     float top = damageRectY;
-    float bottom = mousePos.y + damageZoneSize / 2;
+    float bottom = cursor.y + damageZoneSize / 2;
 
     // Drawing all 8 corner lines
-    DrawLineEx(Vector2{ left, top }, Vector2{ left + cornerLength, top }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ left, top }, Vector2{ left, top + cornerLength }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ right, top }, Vector2{ right - cornerLength, top }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ right, top }, Vector2{ right, top + cornerLength }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ left, bottom }, Vector2{ left + cornerLength, bottom }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ left, bottom }, Vector2{ left, bottom - cornerLength }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ right, bottom }, Vector2{ right - cornerLength, bottom }, cornerThickness, cornerColor);
-    DrawLineEx(Vector2{ right, bottom }, Vector2{ right, bottom - cornerLength }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ left, top }, Vector2{ left + cornerLength, top }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ left, top }, Vector2{ left, top + cornerLength }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ right, top }, Vector2{ right - cornerLength, top }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ right, top }, Vector2{ right, top + cornerLength }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ left, bottom }, Vector2{ left + cornerLength, bottom }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ left, bottom }, Vector2{ left, bottom - cornerLength }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ right, bottom }, Vector2{ right - cornerLength, bottom }, cornerThickness, cornerColor);
+    backend.DrawLineEx(Vector2{ right, bottom }, Vector2{ right, bottom - cornerLength }, cornerThickness, cornerColor);
 
     // Draw Center Target
-    float centerSquareSize = GetScreenHeight() * CENTER_SQUARE_SIZE_RATIO;
-    DrawRectangle(
-        static_cast<int>(mousePos.x - centerSquareSize / 2),
-        static_cast<int>(mousePos.y - centerSquareSize / 2),
+    float centerSquareSize = backend.GetScreenHeight() * CENTER_SQUARE_SIZE_RATIO;
+    backend.DrawRectangle(
+        static_cast<int>(cursor.x - centerSquareSize / 2),
+        static_cast<int>(cursor.y - centerSquareSize / 2),
         static_cast<int>(centerSquareSize),
         static_cast<int>(centerSquareSize),
         WHITE);
+    m_Commands.EndAnchored();
 
     // Draw HUD / Overlays
-
-    Renderer::DrawProgressBar(m_Game.GetLevelService().GetProgressBarPercentage(), m_Game.GetLevelService().GetCurrentLevel(), m_Font);
-
-    int healthBarX = static_cast<int>(GetScreenWidth() * 0.01f);
-    int healthBarY = static_cast<int>(GetScreenHeight() * 0.01f);
-    int healthBarWidth = static_cast<int>(GetScreenWidth() * 0.2f);
-    int healthBarHeight = static_cast<int>(GetScreenHeight() * 0.03f);
-    Renderer::DrawHealthBar(m_Game.GetHealthService().GetCurrent(), m_Game.GetUpgradeService().GetMaxHealth(), healthBarX, healthBarY, healthBarWidth, healthBarHeight, m_Font);
-
-    int pointsX = static_cast<int>(GetScreenWidth() * 0.01f);
-    int pointsY = healthBarY + healthBarHeight + static_cast<int>(GetScreenHeight() * 0.015f);
-    int pointsFontSize = static_cast<int>(GetScreenHeight() * 0.025f);
-    Renderer::DrawPoints(m_Game.GetPickupService().GetPickupPoints(), pointsX, pointsY, pointsFontSize, WHITE, m_Font);
-
-    int debugX = GetScreenWidth() - static_cast<int>(GetScreenWidth() * 0.02f);
-    int debugY = static_cast<int>(GetScreenHeight() * 0.01f);
-    Renderer::DrawDebugInfo(debugX, debugY, m_Font);
-
-    rlPopMatrix();
+    m_Commands.SetLayer(DrawLayer::Hud);
+    Renderer::DrawProgressBar(hud.levelProgress, hud.level, m_Font);
+
+    int healthBarX = static_cast<int>(backend.GetScreenWidth() * 0.01f);
+    int healthBarY = static_cast<int>(backend.GetScreenHeight() * 0.01f);
+    int healthBarWidth = static_cast<int>(backend.GetScreenWidth() * 0.2f);
+    int healthBarHeight = static_cast<int>(backend.GetScreenHeight() * 0.03f);
+    Renderer::DrawHealthBar(hud.health, hud.maxHealth, healthBarX, healthBarY, healthBarWidth, healthBarHeight, m_Font);
+
+    int pointsX = static_cast<int>(backend.GetScreenWidth() * 0.01f);
+    int pointsY = healthBarY + healthBarHeight + static_cast<int>(backend.GetScreenHeight() * 0.015f);
+    int pointsFontSize = static_cast<int>(backend.GetScreenHeight() * 0.025f);
+    Renderer::DrawPoints(hud.points, pointsX, pointsY, pointsFontSize, WHITE, m_Font);
+
+    backend.PopMatrix();
+
+    Renderer::SetBackend(&target);
+
+    // Late latch: the freshest cursor sample places the anchored draws, and the next
+    // simulation tick starts from the same position
+    Vector2 latchedMouse = InputHandler::GetLatestMousePosition();
+    m_Simulation.SetMousePosition(latchedMouse.x, latchedMouse.y);
+    m_Commands.SetAnchor(latchedMouse);
+    m_Commands.Submit();
+
+    // Drawn straight to the target after Submit(), so it shows this frame's draw calls (not counting its own)
+    int debugX = target.GetScreenWidth() - static_cast<int>(target.GetScreenWidth() * 0.02f);
+    int debugY = static_cast<int>(target.GetScreenHeight() * 0.01f);
+    target.PushMatrix();
+    target.Translate(m_ShakeOffset.x, m_ShakeOffset.y);
+    Renderer::DrawDebugInfo(debugX, debugY, m_Font, hud.liveNodes, hud.peakNodes, m_Commands.GetDrawCallCount(), m_Governor);
+    target.PopMatrix();
 }
\ No newline at end of file
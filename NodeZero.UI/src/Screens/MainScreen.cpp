@@ -53,23 +53,26 @@ MainScreen::MainScreen(std::function<void(GameScreen)> stateChangeCallback, Font
     quitButton->SetColors(Color{ 180, 70, 70, 255 }, Color{ 210, 100, 100, 255 }, Color{ 150, 40, 40, 255 }, WHITE);
     quitButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Quit); });
     m_Menu->AddWidget(std::move(quitButton));
+
+    // Watermark
+    auto watermark = std::make_unique<Label>(
+        screenWidth * WATERMARK_X_RATIO,
+        screenHeight * WATERMARK_Y_RATIO,
+        "Made by TeamTBD",
+        font,
+        static_cast<int>(watermarkFontSize),
+        Color{ 150, 150, 150, 200 });
+    m_Menu->AddWidget(std::move(watermark));
 }
 
 void MainScreen::Update(float deltaTime) {
     m_Menu->Update();
 }
 
+void MainScreen::RenderOffscreen() {
+    m_Menu->RenderOffscreen();
+}
+
 void MainScreen::Draw() {
     m_Menu->Draw();
-
-    // Watermark
-    const char* watermarkText = "Made by TeamTBD";
-    DrawTextEx(m_Font, watermarkText,
-        Vector2{
-            static_cast<float>(GetScreenWidth() * WATERMARK_X_RATIO),
-            static_cast<float>(GetScreenHeight() * WATERMARK_Y_RATIO)
-        },
-        static_cast<float>(GetScreenHeight() * WATERMARK_FONT_RATIO),
-        1,
-        Color{ 150, 150, 150, 200 });
 }
\ No newline at end of file
@@ -1,11 +1,12 @@
 #include "Screens/PauseScreen.h"
 
 #include "Config/GameConfig.h"
+#include "Renderer.h"
 #include "Widgets/Button.h"
 #include "Widgets/Label.h"
 
-PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback) {
+PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font, DynamicResolution& resolution)
+    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_Resolution(resolution), m_QualityButton(nullptr), m_QualityIndex(0) {
     m_Menu = std::make_unique<Menu>();
 
     const int screenWidth = GetScreenWidth();
@@ -40,8 +41,15 @@ PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChang
     resumeButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Playing); });
     m_Menu->AddWidget(std::move(resumeButton));
 
+    // Quality Button (cycles the render scale presets)
+    auto qualityButton = std::make_unique<Button>(centerX, startY + buttonHeight + buttonSpacing, buttonWidth, buttonHeight, QUALITY_LABELS[0], font);
+    qualityButton->SetColors(Color{ 50, 90, 150, 255 }, Color{ 80, 120, 180, 255 }, Color{ 30, 70, 120, 255 }, WHITE);
+    qualityButton->SetOnClick([this]() { CycleQuality(); });
+    m_QualityButton = qualityButton.get();
+    m_Menu->AddWidget(std::move(qualityButton));
+
     // Terminate Button
-    auto terminateButton = std::make_unique<Button>(centerX, startY + buttonHeight + buttonSpacing, buttonWidth, buttonHeight, "Terminate", font);
+    auto terminateButton = std::make_unique<Button>(centerX, startY + 2 * (buttonHeight + buttonSpacing), buttonWidth, buttonHeight, "Terminate", font);
     terminateButton->SetColors(Color{ 180, 50, 50, 255 }, Color{ 210, 80, 80, 255 }, Color{ 150, 30, 30, 255 }, WHITE);
     terminateButton->SetOnClick([this]() {
         m_Game.SaveProgress();
@@ -57,8 +65,19 @@ void PauseScreen::Update(float deltaTime) {
     }
 }
 
+void PauseScreen::CycleQuality() {
+    m_QualityIndex = (m_QualityIndex + 1) % QUALITY_PRESET_COUNT;
+    m_Resolution.SetFixedScale(QUALITY_PRESETS[m_QualityIndex]);
+    m_QualityButton->SetText(QUALITY_LABELS[m_QualityIndex]);
+}
+
+void PauseScreen::RenderOffscreen() {
+    m_Menu->RenderOffscreen();
+}
+
 void PauseScreen::Draw() {
     // Draw semi-transparent black overlay
-    DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Color{ 0, 0, 0, OVERLAY_ALPHA });
+    IRenderBackend& backend = Renderer::GetBackend();
+    backend.DrawRectangle(0, 0, backend.GetScreenWidth(), backend.GetScreenHeight(), Color{ 0, 0, 0, OVERLAY_ALPHA });
     m_Menu->Draw();
 }
\ No newline at end of file
@@ -2,32 +2,132 @@
 
 #include <cstdio>
 
+#include "Renderer.h"
 #include "Services/IUpgradeService.h"
 #include "Services/ISaveService.h"
 
 UpgradesScreen::UpgradesScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_WasMousePressed(false), m_IsFirstFrame(true), m_Font(font) {
+    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_WasMousePressed(false), m_IsFirstFrame(true), m_Font(font),
+    m_IsDirty(true), m_HoveredButton(-1) {
 }
 
 void UpgradesScreen::Update(float deltaTime) {
     if (IsKeyPressed(KEY_ESCAPE)) {
         m_StateChangeCallback(GameScreen::MainMenu);
         m_IsFirstFrame = true; // Reset mouse state tracking
+        return;
     }
+
+    Vector2 mousePos = GetMousePosition();
+    bool isMousePressed = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
+
+    int hoveredButton = -1;
+    for (int i = 0; i < UPGRADE_COUNT; ++i) {
+        if (CheckCollisionPointRec(mousePos, GetButtonRect(i))) {
+            hoveredButton = i;
+        }
+    }
+
+    // Hover only changes the button highlight, but that still needs a repaint
+    if (hoveredButton != m_HoveredButton) {
+        m_HoveredButton = hoveredButton;
+        m_IsDirty = true;
+    }
+
+    // Click Logic
+    if (!m_IsFirstFrame && hoveredButton >= 0 && isMousePressed && !m_WasMousePressed) {
+        UpgradeOption option = GetOption(hoveredButton);
+        bool canAfford = m_Game.GetSaveService().GetCurrentData().points >= option.cost && !option.isMaxed;
+
+        if (canAfford && BuyOption(hoveredButton)) {
+            m_IsDirty = true; // Points, stats and costs changed
+        }
+    }
+
+    // Update mouse state tracking
+    m_WasMousePressed = isMousePressed;
+    m_IsFirstFrame = false;
+}
+
+void UpgradesScreen::Invalidate() {
+    m_IsDirty = true;
+}
+
+void UpgradesScreen::RenderOffscreen() {
+    if (!m_IsDirty && m_Layer.IsValid()) {
+        return;
+    }
+
+    m_Layer.Begin();
+    Paint();
+    m_Layer.End();
+    m_IsDirty = false;
 }
 
 void UpgradesScreen::Draw() {
+    m_Layer.Draw();
+}
+
+UpgradesScreen::UpgradeOption UpgradesScreen::GetOption(int index) const {
+    IUpgradeService& upgrades = m_Game.GetUpgradeService();
+
+    switch (index) {
+    case 0:  return UpgradeOption{ "Upgrade +1.0 HP", upgrades.GetHealthUpgradeCost(), false };
+    case 1:  return UpgradeOption{ "Upgrade +0.1 Regen", upgrades.GetRegenUpgradeCost(), false };
+    case 2:  return UpgradeOption{ "Upgrade +10 Zone", upgrades.GetDamageZoneUpgradeCost(), upgrades.GetDamageZoneSize() >= DAMAGE_ZONE_MAX_SIZE };
+    default: return UpgradeOption{ "Upgrade +5 Damage", upgrades.GetDamageUpgradeCost(), false };
+    }
+}
+
+bool UpgradesScreen::BuyOption(int index) {
+    IUpgradeService& upgrades = m_Game.GetUpgradeService();
+
+    switch (index) {
+    case 0:  return upgrades.BuyHealthUpgrade();
+    case 1:  return upgrades.BuyRegenUpgrade();
+    case 2:  return upgrades.BuyDamageZoneUpgrade();
+    default: return upgrades.BuyDamageUpgrade();
+    }
+}
+
+Rectangle UpgradesScreen::GetButtonRect(int index) const {
     int screenWidth = GetScreenWidth();
     int screenHeight = GetScreenHeight();
 
+    int buttonWidth = static_cast<int>(screenWidth * BUTTON_WIDTH_RATIO);
+    int buttonHeight = static_cast<int>(screenHeight * BUTTON_HEIGHT_RATIO);
+    int buttonSpacing = static_cast<int>(screenHeight * BUTTON_SPACING_RATIO);
+
+    int buttonX = screenWidth / 2 - buttonWidth / 2;
+    int upgradeY = static_cast<int>(screenHeight * UPGRADE_Y_START_RATIO);
+    int buttonY = upgradeY + static_cast<int>(screenHeight * 0.01f) + index * (buttonHeight + buttonSpacing);
+
+    return Rectangle{ static_cast<float>(buttonX), static_cast<float>(buttonY),
+                      static_cast<float>(buttonWidth), static_cast<float>(buttonHeight) };
+}
+
+void UpgradesScreen::Paint() {
+    int screenWidth = GetScreenWidth();
+    int screenHeight = GetScreenHeight();
+    IRenderBackend& backend = Renderer::GetBackend();
+
+    // All text goes through the cache: layout happens once per distinct string and size
+    auto drawText = [&](const char* text, Vector2 position, int fontSize, Color color) {
+        m_TextCache.Get(text, m_Font, static_cast<float>(fontSize)).Draw(backend, position, color);
+    };
+    auto measureText = [&](const char* text, int fontSize) {
+        return m_TextCache.Get(text, m_Font, static_cast<float>(fontSize)).GetSize();
+    };
+
     // Title
     int titleFontSize = static_cast<int>(screenHeight * TITLE_TEXT_HEIGHT_RATIO);
-    Vector2 titleSize = MeasureTextEx(m_Font, "UPGRADES", static_cast<float>(titleFontSize), 1);
-    DrawTextEx(m_Font, "UPGRADES",
+    Vector2 titleSize = measureText("UPGRADES", titleFontSize);
+    drawText("UPGRADES",
         Vector2{ static_cast<float>(screenWidth / 2 - titleSize.x / 2),
-                static_cast<float>(screenHeight * TITLE_Y_RATIO) },
-        static_cast<float>(titleFontSize), 1, WHITE);
+            static_cast<float>(screenHeight * TITLE_Y_RATIO) },
+        titleFontSize, WHITE);
 
+    // Only read and formatted on a repaint, not every frame
     SaveData saveData = m_Game.GetSaveService().GetCurrentData();
 
     // Statistics Column Layout
@@ -38,144 +138,101 @@ void UpgradesScreen::Draw() {
     int statTextFontSize = static_cast<int>(screenHeight * STATS_TEXT_FONT_RATIO);
 
     // Subtitle
-    DrawTextEx(m_Font, "STATISTICS", Vector2{ static_cast<float>(statsX), static_cast<float>(statsY) }, static_cast<float>(subtitleFontSize), 1, YELLOW);
+    drawText("STATISTICS", Vector2{ static_cast<float>(statsX), static_cast<float>(statsY) }, subtitleFontSize, YELLOW);
 
     // Draw Statistics
     int currentStatsY = statsY + statsSpacing;
     char buffer[64];
 
     snprintf(buffer, sizeof(buffer), "Points: %d", saveData.points);
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, Color{ 255, 215, 0, 255 });
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, Color{ 255, 215, 0, 255 });
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "High Points: %d", saveData.highPoints);
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Games Played: %d", saveData.gamesPlayed);
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Total Nodes: %d", saveData.totalNodesDestroyed);
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Max Health: %.0f", m_Game.GetUpgradeService().GetMaxHealth());
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Regen Rate: %.1f/s", m_Game.GetUpgradeService().GetRegenRate());
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Damage Zone: %.0f", m_Game.GetUpgradeService().GetDamageZoneSize());
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
     snprintf(buffer, sizeof(buffer), "Damage/Tick: %.0f", m_Game.GetUpgradeService().GetDamagePerTick());
-    DrawTextEx(m_Font, buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, static_cast<float>(statTextFontSize), 1, WHITE);
+    drawText(buffer, Vector2{ static_cast<float>(statsX), static_cast<float>(currentStatsY) }, statTextFontSize, WHITE);
     currentStatsY += statsSpacing;
 
-
     // Upgrade Column Layout
     int upgradeTitleFontSize = static_cast<int>(screenHeight * UPGRADE_TITLE_FONT_RATIO);
-    int buttonWidth = static_cast<int>(screenWidth * BUTTON_WIDTH_RATIO);
     int buttonHeight = static_cast<int>(screenHeight * BUTTON_HEIGHT_RATIO);
-    int buttonSpacing = static_cast<int>(screenHeight * BUTTON_SPACING_RATIO);
     int buttonTextFontSize = static_cast<int>(buttonHeight * BUTTON_TEXT_FONT_RATIO);
     int costTextFontSize = static_cast<int>(buttonHeight * COST_TEXT_FONT_RATIO);
 
-    int buttonX = screenWidth / 2 - buttonWidth / 2;
     int upgradeY = static_cast<int>(screenHeight * UPGRADE_Y_START_RATIO);
 
     // Upgrade Column Title
-    Vector2 upgradesTitleSize = MeasureTextEx(m_Font, "UPGRADES", static_cast<float>(upgradeTitleFontSize), 1);
-    DrawTextEx(m_Font, "UPGRADES",
+    Vector2 upgradesTitleSize = measureText("UPGRADES", upgradeTitleFontSize);
+    drawText("UPGRADES",
         Vector2{ static_cast<float>(screenWidth / 2 - upgradesTitleSize.x / 2),
-                static_cast<float>(upgradeY - screenHeight * 0.05f) },
-        static_cast<float>(upgradeTitleFontSize), 1, Color{ 100, 200, 255, 255 });
+            static_cast<float>(upgradeY - screenHeight * 0.05f) },
+        upgradeTitleFontSize, Color{ 100, 200, 255, 255 });
 
-    Vector2 mousePos = GetMousePosition();
-    bool isMousePressed = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
-    int currentButtonY = upgradeY + static_cast<int>(screenHeight * 0.01f);
+    for (int i = 0; i < UPGRADE_COUNT; ++i) {
+        UpgradeOption option = GetOption(i);
+        Rectangle buttonRect = GetButtonRect(i);
+        bool isHovered = (i == m_HoveredButton);
 
-    // Lambda to handle drawing and clicking a single button
-    auto drawAndClickUpgradeButton = [&](int& currentY, const char* upgradeText, int cost, bool isMaxed, const std::function<bool()>& buyAction) {
-        Rectangle buttonRect = { static_cast<float>(buttonX), static_cast<float>(currentY),
-                                static_cast<float>(buttonWidth), static_cast<float>(buttonHeight) };
-        bool isHovered = CheckCollisionPointRec(mousePos, buttonRect);
-
-        bool canAfford = saveData.points >= cost && !isMaxed;
-        Color buttonColor = isMaxed
+        bool canAfford = saveData.points >= option.cost && !option.isMaxed;
+        Color buttonColor = option.isMaxed
             ? Color{ 50, 50, 50, 255 }
             : (canAfford ? (isHovered ? Color{ 80, 180, 80, 255 } : Color{ 60, 160, 60, 255 })
                 : Color{ 100, 100, 100, 255 });
 
-        DrawRectangleRec(buttonRect, buttonColor);
-        DrawRectangleLinesEx(buttonRect, 1, WHITE);
+        int buttonX = static_cast<int>(buttonRect.x);
+        int buttonY = static_cast<int>(buttonRect.y);
+        int buttonW = static_cast<int>(buttonRect.width);
+        int buttonH = static_cast<int>(buttonRect.height);
+        backend.DrawRectangle(buttonX, buttonY, buttonW, buttonH, buttonColor);
+        backend.DrawRectangleLines(buttonX, buttonY, buttonW, buttonH, WHITE);
 
         // Button Text
         char buttonText[64];
-        snprintf(buttonText, sizeof(buttonText), "%s", isMaxed ? "MAX LEVEL" : upgradeText);
-        Vector2 buttonTextSize = MeasureTextEx(m_Font, buttonText, static_cast<float>(buttonTextFontSize), 1);
-        DrawTextEx(m_Font, buttonText,
-            Vector2{ static_cast<float>(buttonX + buttonWidth / 2 - buttonTextSize.x / 2),
-                    static_cast<float>(currentY + buttonHeight * BUTTON_TEXT_Y_RATIO) },
-            static_cast<float>(buttonTextFontSize), 1, WHITE);
+        snprintf(buttonText, sizeof(buttonText), "%s", option.isMaxed ? "MAX LEVEL" : option.label);
+        Vector2 buttonTextSize = measureText(buttonText, buttonTextFontSize);
+        drawText(buttonText,
+            Vector2{ buttonRect.x + buttonRect.width / 2 - buttonTextSize.x / 2,
+                buttonRect.y + buttonHeight * BUTTON_TEXT_Y_RATIO },
+            buttonTextFontSize, WHITE);
 
         // Cost Text
         char costText[32];
-        snprintf(costText, sizeof(costText), "%s", isMaxed ? "Maxed out" : TextFormat("Cost: %d points", cost));
-        Vector2 costTextSize = MeasureTextEx(m_Font, costText, static_cast<float>(costTextFontSize), 1);
-        DrawTextEx(m_Font, costText,
-            Vector2{ static_cast<float>(buttonX + buttonWidth / 2 - costTextSize.x / 2),
-                    static_cast<float>(currentY + buttonHeight * COST_TEXT_Y_RATIO) },
-            static_cast<float>(costTextFontSize), 1, LIGHTGRAY);
-
-        // Click Logic
-        if (!m_IsFirstFrame && isHovered && canAfford && isMousePressed && !m_WasMousePressed) {
-            if (buyAction()) {
-                // Refresh data immediately after a successful purchase
-                saveData = m_Game.GetSaveService().GetCurrentData();
-            }
-        }
-
-        // Move Y position for next button
-        currentY += buttonHeight + buttonSpacing;
-        };
-
-
-    // Health Upgrade
-    drawAndClickUpgradeButton(currentButtonY, "Upgrade +1.0 HP", m_Game.GetUpgradeService().GetHealthUpgradeCost(), false,
-        [this]() { return m_Game.GetUpgradeService().BuyHealthUpgrade(); }
-    );
-
-    // Regen Upgrade
-    drawAndClickUpgradeButton(currentButtonY, "Upgrade +0.1 Regen", m_Game.GetUpgradeService().GetRegenUpgradeCost(), false,
-        [this]() { return m_Game.GetUpgradeService().BuyRegenUpgrade(); }
-    );
-
-    // Damage Zone Upgrade
-    bool isDamageZoneMaxed = m_Game.GetUpgradeService().GetDamageZoneSize() >= 300.0f;
-    drawAndClickUpgradeButton(currentButtonY, "Upgrade +10 Zone", m_Game.GetUpgradeService().GetDamageZoneUpgradeCost(), isDamageZoneMaxed,
-        [this]() { return m_Game.GetUpgradeService().BuyDamageZoneUpgrade(); }
-    );
-
-    // Damage Upgrade
-    drawAndClickUpgradeButton(currentButtonY, "Upgrade +5 Damage", m_Game.GetUpgradeService().GetDamageUpgradeCost(), false,
-        [this]() { return m_Game.GetUpgradeService().BuyDamageUpgrade(); }
-    );
-
+        snprintf(costText, sizeof(costText), "%s", option.isMaxed ? "Maxed out" : TextFormat("Cost: %d points", option.cost));
+        Vector2 costTextSize = measureText(costText, costTextFontSize);
+        drawText(costText,
+            Vector2{ buttonRect.x + buttonRect.width / 2 - costTextSize.x / 2,
+                buttonRect.y + buttonHeight * COST_TEXT_Y_RATIO },
+            costTextFontSize, LIGHTGRAY);
+    }
 
     // Footer
     int escTextFontSize = static_cast<int>(screenHeight * FOOTER_TEXT_FONT_RATIO);
-    Vector2 escTextSize = MeasureTextEx(m_Font, "Press ESC to return to menu", static_cast<float>(escTextFontSize), 1);
-    DrawTextEx(m_Font, "Press ESC to return to menu",
+    Vector2 escTextSize = measureText("Press ESC to return to menu", escTextFontSize);
+    drawText("Press ESC to return to menu",
         Vector2{ static_cast<float>(screenWidth / 2 - escTextSize.x / 2),
-                static_cast<float>(screenHeight * FOOTER_Y_RATIO) },
-        static_cast<float>(escTextFontSize), 1, LIGHTGRAY);
-
-    // Update mouse state tracking
-    m_WasMousePressed = isMousePressed;
-    m_IsFirstFrame = false;
+            static_cast<float>(screenHeight * FOOTER_Y_RATIO) },
+        escTextFontSize, LIGHTGRAY);
 }
\ No newline at end of file
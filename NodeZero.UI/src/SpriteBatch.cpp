@@ -0,0 +1,43 @@
+#include "SpriteBatch.h"
+
+SpriteBatch::SpriteBatch() {
+    m_Vertices.reserve(INITIAL_SPRITE_CAPACITY * 4);
+}
+
+void SpriteBatch::SetTexture(Texture2D texture) {
+    m_Texture = texture;
+}
+
+void SpriteBatch::Clear() {
+    m_Vertices.clear();
+}
+
+void SpriteBatch::AddSprite(Vector2 center, float halfSize, Color tint) {
+    AddSprite(Rectangle{ center.x - halfSize, center.y - halfSize, halfSize * 2.0f, halfSize * 2.0f }, tint);
+}
+
+void SpriteBatch::AddSprite(Rectangle dest, Color tint) {
+    // Same vertex order as DrawTexturePro: TL, BL, BR, TR
+    m_Vertices.push_back(TextureVertex{ dest.x, dest.y, 0.0f, 0.0f, tint });
+    m_Vertices.push_back(TextureVertex{ dest.x, dest.y + dest.height, 0.0f, 1.0f, tint });
+    m_Vertices.push_back(TextureVertex{ dest.x + dest.width, dest.y + dest.height, 1.0f, 1.0f, tint });
+    m_Vertices.push_back(TextureVertex{ dest.x + dest.width, dest.y, 1.0f, 0.0f, tint });
+}
+
+TextureVertex* SpriteBatch::AppendSprites(int count) {
+    size_t first = m_Vertices.size();
+    m_Vertices.resize(first + static_cast<size_t>(count) * 4);
+    return m_Vertices.data() + first;
+}
+
+void SpriteBatch::Submit(IRenderBackend& backend) {
+    if (!m_Vertices.empty()) {
+        backend.DrawTexturedQuads(m_Texture, m_Vertices.data(), static_cast<int>(m_Vertices.size()));
+    }
+
+    m_Vertices.clear();
+}
+
+size_t SpriteBatch::GetSpriteCount() const {
+    return m_Vertices.size() / 4;
+}
@@ -1,5 +1,7 @@
 #include "Widgets/Button.h"
 
+#include "Renderer.h"
+
 Button::Button(float x, float y, float width, float height, const char* text, Font font)
     : m_X(x),
     m_Y(y),
@@ -12,24 +14,26 @@ Button::Button(float x, float y, float width, float height, const char* text, Fo
     m_TextColor(BLACK),
     m_IsActive(true),
     m_OnClick(nullptr),
-    m_Font(font) {
+    m_Font(font),
+    m_State(VisualState::Normal),
+    m_IsDirty(true) {
 }
 
 void Button::Draw() {
+    m_IsDirty = false;
     if (!m_IsActive)
         return;
 
     Color currentColor = m_NormalColor;
+    if (m_State == VisualState::Pressed)
+        currentColor = m_PressedColor;
+    else if (m_State == VisualState::Hovered)
+        currentColor = m_HoverColor;
 
-    if (IsHovered()) {
-        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
-            currentColor = m_PressedColor;
-        else
-            currentColor = m_HoverColor;
-    }
+    IRenderBackend& backend = Renderer::GetBackend();
 
     // Draw background
-    DrawRectangle(
+    backend.DrawRectangle(
         static_cast<int>(m_X),
         static_cast<int>(m_Y),
         static_cast<int>(m_Width),
@@ -37,7 +41,7 @@ void Button::Draw() {
         currentColor);
 
     // Draw border
-    DrawRectangleLines(
+    backend.DrawRectangleLines(
         static_cast<int>(m_X),
         static_cast<int>(m_Y),
         static_cast<int>(m_Width),
@@ -46,17 +50,30 @@ void Button::Draw() {
 
     // Draw text (Refactor: Use constant for size ratio)
     float fontSize = m_Height * TEXT_SIZE_RATIO;
-    Vector2 textSize = MeasureTextEx(m_Font, m_Text.c_str(), fontSize, 1);
+    if (!m_Label.Matches(m_Text.c_str(), m_Font, fontSize, 1)) {
+        m_Label.Build(m_Text.c_str(), m_Font, fontSize, 1);
+    }
+
+    Vector2 textSize = m_Label.GetSize();
     float textX = m_X + (m_Width - textSize.x) / 2;
     float textY = m_Y + (m_Height - textSize.y) / 2;
 
-    DrawTextEx(m_Font, m_Text.c_str(), Vector2{ textX, textY }, fontSize, 1, m_TextColor);
+    m_Label.Draw(backend, Vector2{ textX, textY }, m_TextColor);
 }
 
 void Button::Update() {
     if (!m_IsActive)
         return;
 
+    VisualState state = VisualState::Normal;
+    if (IsHovered())
+        state = IsMouseButtonDown(MOUSE_LEFT_BUTTON) ? VisualState::Pressed : VisualState::Hovered;
+
+    if (state != m_State) {
+        m_State = state;
+        m_IsDirty = true;
+    }
+
     // Check for click release on the same frame it was pressed
     if (IsHovered() && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         if (m_OnClick)
@@ -75,9 +92,26 @@ bool Button::IsActive() const {
 }
 
 void Button::SetActive(bool active) {
+    if (active != m_IsActive)
+        m_IsDirty = true;
     m_IsActive = active;
 }
 
+bool Button::IsDirty() const {
+    return m_IsDirty;
+}
+
+Rectangle Button::GetBounds() const {
+    return Rectangle{ m_X, m_Y, m_Width, m_Height };
+}
+
+void Button::SetText(const char* text) {
+    if (m_Text == text)
+        return;
+    m_Text = text;
+    m_IsDirty = true;
+}
+
 void Button::SetOnClick(std::function<void()> callback) {
     m_OnClick = callback;
 }
@@ -87,4 +121,5 @@ void Button::SetColors(Color normal, Color hover, Color pressed, Color text) {
     m_HoverColor = hover;
     m_PressedColor = pressed;
     m_TextColor = text;
+    m_IsDirty = true;
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Widgets/Label.h"
 
+#include "Renderer.h"
+
 Label::Label(float x, float y, const char* text, Font font, int fontSize, Color color)
     : m_X(x),
     m_Y(y),
@@ -7,15 +9,21 @@ Label::Label(float x, float y, const char* text, Font font, int fontSize, Color
     m_FontSize(fontSize),
     m_Color(color),
     m_IsActive(true),
-    m_Font(font) {
+    m_Font(font),
+    m_IsDirty(true) {
 }
 
 void Label::Draw() {
+    m_IsDirty = false;
     if (!m_IsActive)
         return;
 
-    // The '1' in DrawTextEx is the spacing parameter (defaults to 1 for no extra spacing)
-    DrawTextEx(m_Font, m_Text.c_str(), Vector2{ m_X, m_Y }, static_cast<float>(m_FontSize), 1, m_Color);
+    // The '1' is the spacing parameter (defaults to 1 for no extra spacing)
+    float fontSize = static_cast<float>(m_FontSize);
+    if (!m_Run.Matches(m_Text.c_str(), m_Font, fontSize, 1)) {
+        m_Run.Build(m_Text.c_str(), m_Font, fontSize, 1);
+    }
+    m_Run.Draw(Renderer::GetBackend(), Vector2{ m_X, m_Y }, m_Color);
 }
 
 void Label::Update() {
@@ -32,13 +40,35 @@ bool Label::IsActive() const {
 }
 
 void Label::SetActive(bool active) {
+    if (active != m_IsActive)
+        m_IsDirty = true;
     m_IsActive = active;
 }
 
+bool Label::IsDirty() const {
+    return m_IsDirty;
+}
+
+Rectangle Label::GetBounds() const {
+    Vector2 size = MeasureTextEx(m_Font, m_Text.c_str(), static_cast<float>(m_FontSize), 1);
+    return Rectangle{ m_X, m_Y, size.x, size.y };
+}
+
 void Label::SetText(const char* text) {
+    if (m_Text == text)
+        return;
     m_Text = text;
+    m_IsDirty = true;
 }
 
 const char* Label::GetText() const {
     return m_Text.c_str();
+}
+
+void Label::SetPosition(float x, float y) {
+    if (x == m_X && y == m_Y)
+        return;
+    m_X = x;
+    m_Y = y;
+    m_IsDirty = true;
 }
\ No newline at end of file
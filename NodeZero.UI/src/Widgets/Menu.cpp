@@ -1,19 +1,58 @@
 #include "Widgets/Menu.h"
 
+#include <algorithm>
+
 Menu::Menu()
-    : m_IsActive(true) {
+    : m_IsActive(true),
+    m_IsDirty(true) {
 }
 
 void Menu::Draw() {
+    m_IsDirty = false;
     if (!m_IsActive)
         return;
 
+    if (m_Layer.IsValid()) {
+        m_Layer.Draw();
+        return;
+    }
+
     for (auto& widget : m_Widgets) {
         if (widget)
             widget->Draw();
     }
 }
 
+void Menu::RenderOffscreen() {
+    if (!m_IsActive)
+        return;
+
+    // Full repaint on first use, after a resize or when widgets were added/removed
+    if (!m_Layer.IsValid() || m_DrawnBounds.size() != m_Widgets.size()) {
+        m_Layer.Begin();
+        m_DrawnBounds.clear();
+        for (auto& widget : m_Widgets) {
+            m_DrawnBounds.push_back(widget->GetBounds());
+            widget->Draw();
+        }
+        m_Layer.End();
+        return;
+    }
+
+    // Partial repaint: each dirty widget is redrawn alone over its old and new area
+    for (size_t i = 0; i < m_Widgets.size(); ++i) {
+        IWidget& widget = *m_Widgets[i];
+        if (!widget.IsDirty())
+            continue;
+
+        Rectangle bounds = widget.GetBounds();
+        m_Layer.BeginRegion(Union(m_DrawnBounds[i], bounds));
+        widget.Draw();
+        m_Layer.End();
+        m_DrawnBounds[i] = bounds;
+    }
+}
+
 void Menu::Update() {
     if (!m_IsActive)
         return;
@@ -37,9 +76,32 @@ bool Menu::IsActive() const {
 }
 
 void Menu::SetActive(bool active) {
+    if (active != m_IsActive)
+        m_IsDirty = true;
     m_IsActive = active;
 }
 
+bool Menu::IsDirty() const {
+    if (m_IsDirty)
+        return true;
+    for (const auto& widget : m_Widgets) {
+        if (widget->IsDirty())
+            return true;
+    }
+    return false;
+}
+
+Rectangle Menu::GetBounds() const {
+    if (m_Widgets.empty())
+        return Rectangle{ 0, 0, 0, 0 };
+
+    Rectangle bounds = m_Widgets.front()->GetBounds();
+    for (const auto& widget : m_Widgets) {
+        bounds = Union(bounds, widget->GetBounds());
+    }
+    return bounds;
+}
+
 void Menu::AddWidget(std::unique_ptr<IWidget> widget) {
     if (widget)
         m_Widgets.push_back(std::move(widget));
@@ -48,4 +110,14 @@ void Menu::AddWidget(std::unique_ptr<IWidget> widget) {
 void Menu::Clear() {
     // Removes all unique_ptrs, destroying the managed widgets.
     m_Widgets.clear();
+    m_DrawnBounds.clear();
+    m_IsDirty = true;
+}
+
+Rectangle Menu::Union(Rectangle a, Rectangle b) {
+    float left = std::min(a.x, b.x);
+    float top = std::min(a.y, b.y);
+    float right = std::max(a.x + a.width, b.x + b.width);
+    float bottom = std::max(a.y + a.height, b.y + b.height);
+    return Rectangle{ left, top, right - left, bottom - top };
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+# Packs the fonts and shaders into one C++ source file, compiled into NodeZero.UI.
+#
+# Run as a script: cmake -DASSET_ROOT=<assets dir> -DOUTPUT=<file.cpp> -P EmbedAssets.cmake
+#
+# Every file is appended to a single byte array (AssetPack::BLOB) followed by a zero
+# byte, so text assets can be used as C strings in place. AssetPack::INDEX lists each
+# file's path (relative to ASSET_ROOT, '/' separated), offset and size, sorted by path.
+
+if(NOT ASSET_ROOT OR NOT OUTPUT)
+    message(FATAL_ERROR "EmbedAssets.cmake needs -DASSET_ROOT=... and -DOUTPUT=...")
+endif()
+
+file(GLOB_RECURSE ASSET_FILES RELATIVE ${ASSET_ROOT}
+    "${ASSET_ROOT}/fonts/*"
+    "${ASSET_ROOT}/shaders/*"
+)
+list(SORT ASSET_FILES)
+
+# 32 bytes (64 hex digits); CMake regexes have no {n} repetition
+string(REPEAT "[0-9a-f]" 64 LINE_OF_HEX)
+
+set(BLOB_LINES "")
+set(INDEX_LINES "")
+set(OFFSET 0)
+
+foreach(ASSET ${ASSET_FILES})
+    file(READ "${ASSET_ROOT}/${ASSET}" HEX HEX)
+    string(LENGTH "${HEX}" HEX_LENGTH)
+    math(EXPR SIZE "${HEX_LENGTH} / 2")
+
+    # 32 bytes per line, every byte as 0xNN, then the terminating zero
+    string(REGEX REPLACE "(${LINE_OF_HEX})" "\\1\n    " HEX "${HEX}")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${HEX}")
+
+    string(APPEND BLOB_LINES "    // ${ASSET}\n    ${BYTES}0x00,\n")
+    string(APPEND INDEX_LINES "    { \"${ASSET}\", ${OFFSET}, ${SIZE} },\n")
+    math(EXPR OFFSET "${OFFSET} + ${SIZE} + 1")
+endforeach()
+
+list(LENGTH ASSET_FILES ASSET_COUNT)
+if(ASSET_COUNT EQUAL 0)
+    # Zero-length arrays are not valid C++
+    set(BLOB_LINES "    0x00,\n")
+    set(INDEX_LINES "    { \"\", 0, 0 },\n")
+endif()
+
+set(CONTENT "// Generated by cmake/EmbedAssets.cmake from NodeZero.UI/assets. Do not edit.\n\
+\n\
+#include \"AssetPack.h\"\n\
+\n\
+alignas(16) const unsigned char AssetPack::BLOB[] = {\n\
+${BLOB_LINES}};\n\
+\n\
+const AssetPack::Entry AssetPack::INDEX[] = {\n\
+${INDEX_LINES}};\n\
+\n\
+const size_t AssetPack::ENTRY_COUNT = ${ASSET_COUNT};\n")
+
+file(WRITE "${OUTPUT}" "${CONTENT}")